@@ -25,6 +25,7 @@
 #include <hubero_core/tasks/task_talk.h>
 
 #include <hubero_core/fsm/fsm_super.h>
+#include <hubero_core/navigation/goal_update_policy.h>
 
 #include <memory>
 
@@ -36,9 +37,21 @@ namespace hubero {
  */
 class Actor {
 public:
-	/// Defines how often goal will be updated during execution of a "tracking" navigation task (in seconds)
+	/// Defines max period between goal updates during execution of a "tracking" navigation task (in seconds)
 	const double GOAL_UPDATE_PERIOD_DEFAULT = 5.0;
 
+	/**
+	 * Defines min period between goal updates during execution of a "tracking" navigation task (in seconds);
+	 * applies if navigation supports incremental planning
+	 */
+	const double GOAL_UPDATE_PERIOD_MIN_INCREMENTAL = 0.5;
+
+	/**
+	 * Defines min period between goal updates during execution of a "tracking" navigation task (in seconds);
+	 * applies if navigation plans from scratch
+	 */
+	const double GOAL_UPDATE_PERIOD_MIN_DEFAULT = 2.0;
+
 	/// Defines how often the planning will be executed while looking for a valid navigation goal (in seconds)
 	const double CHOOSE_NEW_GOAL_RETRY_PERIOD_DEFAULT = 0.5;
 
@@ -119,6 +132,14 @@ protected:
 
 	/// @}
 
+	/**
+	 * @brief Updates navigation goal of the task that tracks a moving target, if the target moved enough
+	 *
+	 * @param target_pose recent pose of the target
+	 * @param target_name name of the target, for logging
+	 */
+	void updateTrackedGoal(const Pose3& target_pose, const std::string& target_name);
+
 	/// @brief Updates predicates of the highest level Finite State Machine
 	void updateFsmSuper();
 
@@ -134,6 +155,9 @@ protected:
 	/// Highest level Finite State Machine that orchestrates Actor tasks
 	FsmSuper fsm_;
 
+	/// Decides when goals of tasks that track a moving target are updated
+	GoalUpdatePolicy goal_update_policy_;
+
 	/**
 	 * @defgroup taskclass Task classes that orchestrate specific tasks
 	 * @note Tasks stored as shared_ptr to pass them to TaskRequest class
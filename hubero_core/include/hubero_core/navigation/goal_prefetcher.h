@@ -0,0 +1,94 @@
+#pragma once
+
+#include <hubero_common/typedefs.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Samples and validates upcoming navigation goals in background threads
+ *
+ * @details Goals are sampled (with a user-provided function) starting from the pose given in @ref setStart,
+ * typically the goal that the agent currently moves to. Once the agent reaches it, the next goal can be
+ * popped immediately instead of being sampled and validated in the simulation thread. Changing the start
+ * discards goals sampled from the previous one.
+ */
+class GoalPrefetcher {
+public:
+	/**
+	 * @brief Function that returns a goal reachable from the given start pose (first element is false if not found)
+	 *
+	 * @details Called from the worker threads concurrently, so it must be thread-safe
+	 */
+	typedef std::function<std::tuple<bool, Pose3>(const Pose3&)> Sampler;
+
+	// TODO: would look cleaner with C++17 'static constexpr'
+	/// Default number of goals kept ready
+	static const size_t CAPACITY_DEFAULT;
+
+	/// Default number of threads that sample goals
+	static const size_t WORKERS_NUM_DEFAULT;
+
+	/// Time (in milliseconds) that the worker waits after the sampler failed to find a goal
+	static const int RETRY_PERIOD;
+
+	GoalPrefetcher(Sampler sampler, size_t capacity = CAPACITY_DEFAULT, size_t workers_num = WORKERS_NUM_DEFAULT);
+
+	/**
+	 * @brief Stops workers, waits for samplers that are still running
+	 */
+	virtual ~GoalPrefetcher();
+
+	/**
+	 * @brief Sets pose that the goals are sampled from, discards goals sampled from the previous one
+	 */
+	void setStart(const Pose3& pose);
+
+	/**
+	 * @brief Retrieves the oldest ready goal
+	 *
+	 * @return false if no goal is ready
+	 */
+	bool pop(Pose3& goal);
+
+	/// @brief Returns number of ready goals
+	size_t getSize() const;
+
+	/// @brief Returns number of sampler calls so far
+	size_t getSamplesNum() const;
+
+protected:
+	void work();
+
+	Sampler sampler_;
+	size_t capacity_;
+
+	/**
+	 * @defgroup goalprefetchstate State shared with the workers, guarded by @ref mutex_
+	 * @{
+	 */
+	std::deque<Pose3> goals_;
+	Pose3 start_;
+	bool start_valid_;
+	/// Incremented at each @ref setStart, so goals sampled from the previous start are dropped
+	uint64_t generation_;
+	/// Number of sampler calls in progress
+	size_t pending_;
+	size_t samples_;
+	bool stop_;
+	mutable std::mutex mutex_;
+	std::condition_variable cv_;
+	/// @}
+
+	std::vector<std::thread> workers_;
+}; // class GoalPrefetcher
+
+} // namespace hubero
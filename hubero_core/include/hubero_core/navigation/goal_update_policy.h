@@ -0,0 +1,172 @@
+#pragma once
+
+#include <hubero_common/typedefs.h>
+#include <hubero_common/time.h>
+
+#include <cmath>
+
+namespace hubero {
+
+/**
+ * @brief Decides when the navigation goal of a task that tracks a moving target should be updated
+ *
+ * @details Goal is re-targeted only when the target drifted away from the pose it had during the last update
+ * (position or heading), or when its predicted position diverges from the one predicted during the last update.
+ * Updates are never triggered more often than @ref Parameters::period_min and at least once
+ * per @ref Parameters::period_max. Stationary targets therefore do not cause replanning, while fast targets
+ * are re-targeted as often as allowed.
+ */
+class GoalUpdatePolicy {
+public:
+	struct Parameters {
+		/// Displacement of the target (in meters) that triggers an update
+		double distance_threshold;
+		/// Change of the target heading (in radians) that triggers an update
+		double heading_threshold;
+		/// How far into the future (in seconds) the target position is predicted
+		double prediction_horizon;
+		/// Divergence of the predicted target positions (in meters) that triggers an update
+		double prediction_threshold;
+		/// Min time between updates (in seconds)
+		double period_min;
+		/// Max time between updates (in seconds)
+		double period_max;
+		/// Weight of the newest sample in the low-pass filter of the target velocity, 1.0 disables filtering
+		double velocity_filter_gain;
+
+		Parameters():
+			distance_threshold(0.5),
+			heading_threshold(0.8),
+			prediction_horizon(1.0),
+			prediction_threshold(0.75),
+			period_min(0.5),
+			period_max(5.0),
+			velocity_filter_gain(0.3)
+		{}
+	};
+
+	GoalUpdatePolicy(const Parameters& params = Parameters()): params_(params) {
+		reset();
+	}
+
+	inline void setParameters(const Parameters& params) {
+		params_ = params;
+	}
+
+	inline Parameters getParameters() const {
+		return params_;
+	}
+
+	/**
+	 * @brief Forgets the target, so the next @ref isUpdateRequired call requests an update
+	 *
+	 * @details Should be called when a new target is being tracked
+	 */
+	inline void reset() {
+		updated_ = false;
+		observed_ = false;
+		velocity_ = Vector3();
+	}
+
+	/**
+	 * @brief Evaluates whether the goal should be updated, given the recent pose of the target
+	 *
+	 * @details Must be called once per simulation step as consecutive poses are used to estimate target velocity
+	 */
+	inline bool isUpdateRequired(const Pose3& target_pose, const Time& time) {
+		observe(target_pose, time);
+		if (!updated_) {
+			return true;
+		}
+
+		double elapsed = Time::computeDuration(update_time_, time).getTime();
+		if (elapsed < params_.period_min) {
+			return false;
+		}
+		if (elapsed >= params_.period_max) {
+			return true;
+		}
+
+		if (computePlanarDistance(target_pose.Pos(), update_pose_.Pos()) >= params_.distance_threshold) {
+			return true;
+		}
+		double heading_diff = std::abs(normalizeAngle(target_pose.Rot().Yaw() - update_pose_.Rot().Yaw()));
+		if (heading_diff >= params_.heading_threshold) {
+			return true;
+		}
+		return computePlanarDistance(predict(target_pose.Pos()), update_prediction_) >= params_.prediction_threshold;
+	}
+
+	/**
+	 * @brief Stores the target state that the goal was updated for
+	 *
+	 * @details Call it only when the new goal was actually applied
+	 */
+	inline void markUpdated(const Pose3& target_pose, const Time& time) {
+		updated_ = true;
+		update_time_ = time;
+		update_pose_ = target_pose;
+		update_prediction_ = predict(target_pose.Pos());
+	}
+
+	/// @brief Returns estimated (planar) velocity of the target
+	inline Vector3 getTargetVelocity() const {
+		return velocity_;
+	}
+
+	/**
+	 * @brief Predicts target position @ref Parameters::prediction_horizon seconds ahead, assuming constant velocity
+	 */
+	inline Vector3 predict(const Vector3& position) const {
+		return position + velocity_ * params_.prediction_horizon;
+	}
+
+protected:
+	inline void observe(const Pose3& target_pose, const Time& time) {
+		if (observed_) {
+			double dt = Time::computeDuration(observation_time_, time).getTime();
+			if (dt <= 0.0) {
+				// same step or time reset
+				return;
+			}
+			Vector3 velocity = (target_pose.Pos() - observation_pose_.Pos()) / dt;
+			velocity.Z(0.0);
+			velocity_ = velocity_ * (1.0 - params_.velocity_filter_gain) + velocity * params_.velocity_filter_gain;
+		}
+		observed_ = true;
+		observation_time_ = time;
+		observation_pose_ = target_pose;
+	}
+
+	static inline double computePlanarDistance(const Vector3& a, const Vector3& b) {
+		return std::hypot(a.X() - b.X(), a.Y() - b.Y());
+	}
+
+	static inline double normalizeAngle(double angle) {
+		return std::atan2(std::sin(angle), std::cos(angle));
+	}
+
+	Parameters params_;
+
+	/**
+	 * @defgroup goalupdateref State of the target during the last goal update
+	 * @{
+	 */
+	bool updated_;
+	Time update_time_;
+	Pose3 update_pose_;
+	Vector3 update_prediction_;
+	/// @}
+
+	/**
+	 * @defgroup goalupdateobs Most recent observation of the target, used for velocity estimation
+	 * @{
+	 */
+	bool observed_;
+	Time observation_time_;
+	Pose3 observation_pose_;
+	Vector3 velocity_;
+	/// @}
+}; // class GoalUpdatePolicy
+
+} // namespace hubero
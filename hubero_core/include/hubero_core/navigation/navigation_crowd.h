@@ -0,0 +1,63 @@
+#pragma once
+
+#include <hubero_core/navigation/navigation_decorator.h>
+#include <hubero_core/navigation/orca_solver.h>
+
+#include <memory>
+
+namespace hubero {
+
+/**
+ * @brief Navigation decorator that makes velocity commands of the decorated navigation collision-free
+ * with respect to other actors
+ *
+ * @details Velocity command of the decorated navigation is treated as the preferred velocity of the actor.
+ * Avoidance is computed for the whole crowd at once by the @ref OrcaSolver, which is shared by all instances
+ * by default. Rotational component of the command is passed through unchanged.
+ */
+class NavigationCrowd: public NavigationDecorator {
+public:
+	/**
+	 * @brief Constructor
+	 *
+	 * @param nav_ptr navigation that provides preferred velocities
+	 * @param solver_ptr solver shared by actors that should avoid each other; process-wide solver is used
+	 * when not given
+	 */
+	NavigationCrowd(std::shared_ptr<NavigationBase> nav_ptr, std::shared_ptr<OrcaSolver> solver_ptr = nullptr);
+
+	virtual ~NavigationCrowd();
+
+	/**
+	 * @brief Updates the decorated navigation and then the state of the actor in the crowd solver
+	 *
+	 * @note @ref vel_lin must be expressed in the same frame as @ref pose
+	 */
+	virtual void update(
+		const Pose3& pose,
+		const Vector3& vel_lin = Vector3(),
+		const Vector3& vel_ang = Vector3()
+	) override;
+
+	/**
+	 * @brief Returns velocity command of the decorated navigation adjusted to avoid collisions with other actors
+	 */
+	virtual Vector3 getVelocityCmd() const override;
+
+	/// @brief Returns solver that is shared by all instances that were not given a specific one
+	static std::shared_ptr<OrcaSolver> getSharedSolver();
+
+protected:
+	std::shared_ptr<OrcaSolver> solver_ptr_;
+
+	/// @brief ID of the actor in the solver
+	size_t agent_id_;
+
+	/// @brief Set once @ref update was called after the latest @ref getVelocityCmd call
+	mutable bool updated_since_query_;
+
+	/// @brief Velocity command returned by the latest @ref getVelocityCmd call
+	mutable Vector3 cmd_vel_;
+}; // class NavigationCrowd
+
+} // namespace hubero
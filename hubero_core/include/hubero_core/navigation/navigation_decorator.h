@@ -0,0 +1,119 @@
+#pragma once
+
+#include <hubero_interfaces/navigation_base.h>
+
+#include <memory>
+
+namespace hubero {
+
+/**
+ * @brief Wraps another @ref NavigationBase implementation and forwards all calls to it
+ *
+ * @details Derived classes override only selected methods to extend the behaviour of the wrapped navigation
+ * (e.g., to post-process velocity commands), while the rest of the interface stays transparent for the Actor
+ */
+class NavigationDecorator: public NavigationBase {
+public:
+	/**
+	 * @brief Constructor
+	 *
+	 * @param nav_ptr navigation that is being decorated; it must be initialized separately as its initialization
+	 * method may require implementation-specific arguments
+	 */
+	NavigationDecorator(std::shared_ptr<NavigationBase> nav_ptr): nav_ptr_(nav_ptr) {}
+
+	virtual ~NavigationDecorator() = default;
+
+	inline virtual bool initialize(const std::string& actor_name, const std::string& world_frame_name) override {
+		return nav_ptr_->initialize(actor_name, world_frame_name);
+	}
+
+	inline virtual bool initialize(
+		const std::string& actor_name,
+		const std::string& world_frame_name,
+		const std::string& global_ref_frame_name
+	) override {
+		return nav_ptr_->initialize(actor_name, world_frame_name, global_ref_frame_name);
+	}
+
+	inline virtual bool isPoseAchievable(const Pose3& start, const Pose3& goal, const std::string& frame) override {
+		return nav_ptr_->isPoseAchievable(start, goal, frame);
+	}
+
+	inline virtual void update(
+		const Pose3& pose,
+		const Vector3& vel_lin = Vector3(),
+		const Vector3& vel_ang = Vector3()
+	) override {
+		nav_ptr_->update(pose, vel_lin, vel_ang);
+	}
+
+	inline virtual bool setGoal(const Pose3& pose, const std::string& frame) override {
+		return nav_ptr_->setGoal(pose, frame);
+	}
+
+	inline virtual bool cancelGoal() override {
+		return nav_ptr_->cancelGoal();
+	}
+
+	inline virtual void finish() override {
+		nav_ptr_->finish();
+	}
+
+	inline virtual std::tuple<bool, Pose3> computeClosestAchievablePose(
+		const Pose3& pose,
+		const std::string& frame
+	) override {
+		return nav_ptr_->computeClosestAchievablePose(pose, frame);
+	}
+
+	inline virtual bool isIncrementalPlanningSupported() const override {
+		return nav_ptr_->isIncrementalPlanningSupported();
+	}
+
+	inline virtual std::tuple<bool, Pose3> findRandomReachableGoal() override {
+		return nav_ptr_->findRandomReachableGoal();
+	}
+
+	inline virtual TaskFeedbackType getFeedback() const override {
+		return nav_ptr_->getFeedback();
+	}
+
+	inline virtual bool isInitialized() const override {
+		return nav_ptr_->isInitialized();
+	}
+
+	inline virtual bool isReady() const override {
+		return nav_ptr_->isReady();
+	}
+
+	inline virtual Vector3 getVelocityCmd() const override {
+		return nav_ptr_->getVelocityCmd();
+	}
+
+	inline virtual Pose3 getGoalPose() const override {
+		return nav_ptr_->getGoalPose();
+	}
+
+	inline virtual std::string getGoalFrame() const override {
+		return nav_ptr_->getGoalFrame();
+	}
+
+	inline virtual std::string getWorldFrame() const override {
+		return nav_ptr_->getWorldFrame();
+	}
+
+	inline virtual std::string getGlobalReferenceFrame() const override {
+		return nav_ptr_->getGlobalReferenceFrame();
+	}
+
+	inline virtual double getGoalTolerance() const override {
+		return nav_ptr_->getGoalTolerance();
+	}
+
+protected:
+	/// @brief Decorated navigation
+	std::shared_ptr<NavigationBase> nav_ptr_;
+}; // class NavigationDecorator
+
+} // namespace hubero
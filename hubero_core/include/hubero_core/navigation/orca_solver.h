@@ -0,0 +1,171 @@
+#pragma once
+
+#include <hubero_common/typedefs.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Crowd-level Optimal Reciprocal Collision Avoidance (ORCA) solver
+ *
+ * @details Computes collision-free planar velocities for all registered agents in a single pass. Agent states are
+ * stored as contiguous arrays (structure of arrays) so that neighbour filtering loops can be vectorized by
+ * the compiler. Half-plane construction and the 2D linear programs follow the RVO2 library
+ * (van den Berg et al., "Reciprocal n-Body Collision Avoidance", 2011).
+ *
+ * @details The solver is lazy - velocities are recomputed only once per round, i.e. when an agent asks for its
+ * velocity again after it already consumed the result of the previous solve. With agents updated sequentially
+ * in one simulation step this gives exactly one solve per step.
+ */
+class OrcaSolver {
+public:
+	/// @brief Solver parameters shared by all agents
+	struct Parameters {
+		/// Radius of the circle that approximates the agent's footprint
+		double radius;
+		/// Maximum distance to other agents that are taken into account
+		double neighbour_distance;
+		/// Maximum number of nearest neighbours taken into account
+		size_t max_neighbours;
+		/// Time horizon that the computed velocities are safe for with respect to other agents
+		double time_horizon;
+		/// Time step used to resolve an already existing collision
+		double time_step;
+		/// Upper limit of the computed speed (the preferred speed is used if it is bigger)
+		double max_speed;
+
+		Parameters():
+			radius(0.3),
+			neighbour_distance(3.0),
+			max_neighbours(10),
+			time_horizon(2.0),
+			time_step(0.1),
+			max_speed(1.5)
+		{}
+	};
+
+	OrcaSolver();
+
+	void setParameters(const Parameters& params);
+
+	Parameters getParameters() const;
+
+	/**
+	 * @brief Registers a new agent, returns its ID
+	 *
+	 * @details Agent does not take part in collision avoidance until its state is set with @ref updateAgent
+	 */
+	size_t addAgent();
+
+	/**
+	 * @brief Unregisters agent, its ID may be reused by an agent added later
+	 */
+	void removeAgent(size_t id);
+
+	/**
+	 * @brief Updates the state of the agent; only planar components (X and Y) of vectors are used
+	 */
+	void updateAgent(size_t id, const Vector3& pos, const Vector3& vel, const Vector3& vel_pref);
+
+	/**
+	 * @brief Returns collision-free velocity of the agent, computing new velocities of all agents if needed
+	 *
+	 * @details Returns zero vector for an unknown or not updated agent
+	 */
+	Vector3 getVelocity(size_t id);
+
+	/**
+	 * @brief Computes new velocities of all agents
+	 */
+	void solve();
+
+	/// @brief Returns number of agents that take part in collision avoidance
+	size_t getAgentsNum() const;
+
+protected:
+	/// @brief Directed line bounding the half-plane of permitted velocities (on the left side of the line)
+	struct Line {
+		double px;
+		double py;
+		double dx;
+		double dy;
+	};
+
+	/// @brief Solves for a single agent; caller must hold the lock
+	void solveAgent(size_t i);
+
+	/// @brief Computes the ORCA half-plane induced by agent @ref j onto agent @ref i
+	Line computeOrcaLine(size_t i, size_t j) const;
+
+	static bool linearProgram1(
+		const std::vector<Line>& lines,
+		size_t line_no,
+		double radius,
+		double opt_x,
+		double opt_y,
+		bool direction_opt,
+		double& result_x,
+		double& result_y
+	);
+
+	static size_t linearProgram2(
+		const std::vector<Line>& lines,
+		double radius,
+		double opt_x,
+		double opt_y,
+		bool direction_opt,
+		double& result_x,
+		double& result_y
+	);
+
+	static void linearProgram3(
+		const std::vector<Line>& lines,
+		size_t begin_line,
+		double radius,
+		double& result_x,
+		double& result_y,
+		std::vector<Line>& proj_lines
+	);
+
+	mutable std::mutex mutex_;
+
+	Parameters params_;
+
+	/**
+	 * @defgroup orcastate Agent states stored as structure of arrays, indexed with agent ID
+	 * @{
+	 */
+	std::vector<double> pos_x_;
+	std::vector<double> pos_y_;
+	std::vector<double> vel_x_;
+	std::vector<double> vel_y_;
+	std::vector<double> vel_pref_x_;
+	std::vector<double> vel_pref_y_;
+	std::vector<double> vel_new_x_;
+	std::vector<double> vel_new_y_;
+	/// Agent slot is occupied
+	std::vector<uint8_t> registered_;
+	/// Agent's state was updated at least once so it takes part in avoidance
+	std::vector<uint8_t> active_;
+	/// Agent does not want to move; others take full responsibility for avoiding it
+	std::vector<uint8_t> idle_;
+	/// Agent already fetched the result of the newest solve
+	std::vector<uint8_t> consumed_;
+	/// @}
+
+	/**
+	 * @defgroup orcascratch Buffers reused between solves to avoid allocations
+	 * @{
+	 */
+	std::vector<double> dist_sq_;
+	std::vector<size_t> neighbours_;
+	std::vector<Line> lines_;
+	std::vector<Line> proj_lines_;
+	/// @}
+}; // class OrcaSolver
+
+} // namespace hubero
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <hubero_interfaces/utils/occupancy_grid.h>
+
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Incremental planner for tracking a moving target on the occupancy grid (D* Lite)
+ *
+ * @details Implements D* Lite (Koenig & Likhachev, 2002) on an 8-connected grid (no corner cutting).
+ * The search tree is rooted at the tracking agent (the "goal" of the original algorithm), while the moving
+ * target plays the role of the original "start". Target displacement is therefore handled incrementally
+ * with the key modifier, and previous search results are reused. Once the agent drifts away from the root
+ * further than @ref setRerootDistance allows, the search is restarted at the agent's cell.
+ *
+ * @details Cell states are invalidated lazily (with generation stamps), so the restart does not touch
+ * the whole map.
+ */
+class DStarLite {
+public:
+	typedef OccupancyGrid::Cell Cell;
+
+	/// Default distance (in cells) that the agent can move away from the root before the search is restarted
+	static const int REROOT_DISTANCE_DEFAULT;
+
+	DStarLite();
+
+	/**
+	 * @brief Provides map to plan on; resets search
+	 */
+	void initialize(std::shared_ptr<const OccupancyGrid> map_ptr);
+
+	bool isInitialized() const;
+
+	void setRerootDistance(int cells);
+
+	/**
+	 * @brief Updates search so that the shortest path between @ref agent and @ref target is known
+	 *
+	 * @details Subsequent calls with slightly displaced cells reuse the results of the previous calls
+	 * @return true if path exists
+	 */
+	bool plan(const Cell& agent, const Cell& target);
+
+	/**
+	 * @brief Changes occupancy of the map cell and repairs the search accordingly
+	 *
+	 * @details Map given in @ref initialize is copied on the first call
+	 */
+	void updateCell(const Cell& cell, bool occupied);
+
+	/**
+	 * @brief Retrieves path computed in the latest @ref plan call
+	 *
+	 * @details Path starts at the root of the search (that may differ from the recent agent cell by up to
+	 * reroot distance) and ends at the target. Empty if path does not exist
+	 */
+	std::vector<Cell> getPath() const;
+
+	/// @brief Returns cost (length in meters) of the path computed in the latest @ref plan call
+	double getPathCost() const;
+
+	/// @brief Returns the number of cell expansions performed by the latest @ref plan call
+	size_t getExpansionsNum() const;
+
+	/// @brief Returns the cell that the search is rooted at
+	Cell getRoot() const;
+
+protected:
+	/// Priority key of a cell
+	struct Key {
+		double k1;
+		double k2;
+
+		inline bool operator<(const Key& other) const {
+			return k1 < other.k1 || (k1 == other.k1 && k2 < other.k2);
+		}
+
+		inline bool operator==(const Key& other) const {
+			return k1 == other.k1 && k2 == other.k2;
+		}
+	};
+
+	/// Entry of the priority queue; entries become stale when the key of the cell changes
+	struct QueueEntry {
+		Key key;
+		size_t index;
+
+		// std::priority_queue is a max-heap
+		inline bool operator<(const QueueEntry& other) const {
+			return other.key < key;
+		}
+	};
+
+	/// Restarts search at the given root
+	void reset(const Cell& root);
+
+	/// Ensures that the lazily reset state of the cell is valid in the current search
+	inline void touch(size_t index);
+
+	inline double getG(size_t index) const;
+	inline double getRhs(size_t index) const;
+
+	/// Octile distance (in meters) between the target and the cell
+	inline double computeHeuristic(const Cell& from, const Cell& to) const;
+
+	inline Key computeKey(size_t index) const;
+
+	/// Cost of the move between neighbouring cells; infinite when blocked
+	double computeCost(const Cell& from, const Cell& to) const;
+
+	/// Recomputes rhs of the cell from its neighbours
+	void updateRhs(size_t index);
+
+	void updateVertex(size_t index);
+
+	void computeShortestPath();
+
+	/// Compares keys treating first components that differ only by round-off errors as equal
+	static bool isKeyLessOrTied(const Key& key, const Key& ref);
+
+	/// Removes stale entries from the top of the queue; returns false if the queue is empty
+	bool cleanQueueTop();
+
+	std::shared_ptr<const OccupancyGrid> map_ptr_;
+
+	/// Map copy created on the first @ref updateCell call
+	std::shared_ptr<OccupancyGrid> map_modified_ptr_;
+
+	int reroot_distance_;
+
+	bool search_valid_;
+	Cell root_;
+	Cell target_;
+	Cell target_last_;
+	double km_;
+
+	/**
+	 * @defgroup dstarstate Search state of cells, indexed with map cell index
+	 * @{
+	 */
+	std::vector<double> g_;
+	std::vector<double> rhs_;
+	/// Key the cell is enqueued with; valid only if @ref in_queue_ is set
+	std::vector<Key> key_;
+	std::vector<uint8_t> in_queue_;
+	/// Generation of the search that the cell state belongs to
+	std::vector<uint32_t> stamp_;
+	uint32_t stamp_current_;
+	/// @}
+
+	std::priority_queue<QueueEntry> queue_;
+
+	size_t expansions_;
+}; // class DStarLite
+
+} // namespace hubero
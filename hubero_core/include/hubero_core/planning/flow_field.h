@@ -0,0 +1,71 @@
+#pragma once
+
+#include <hubero_interfaces/utils/occupancy_grid.h>
+
+#include <memory>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Cost-to-go field of a single destination on the occupancy grid
+ *
+ * @details Costs (path lengths in meters) are computed once with Dijkstra's algorithm expanding from the goal,
+ * following the connectivity rules of @ref DStarLite (8-connected grid, no corner cutting). Afterwards,
+ * the path from any cell is obtained by the steepest descent, so a single field serves any number of agents
+ * heading to the same destination. The field is immutable once constructed, hence it may be shared between threads.
+ */
+class FlowField {
+public:
+	typedef OccupancyGrid::Cell Cell;
+
+	/**
+	 * @brief Computes the field of the @ref goal cell
+	 */
+	FlowField(std::shared_ptr<const OccupancyGrid> map_ptr, const Cell& goal);
+
+	/// @brief Returns false if the goal is occupied (so no cell is able to reach it)
+	bool isValid() const;
+
+	inline Cell getGoal() const {
+		return goal_;
+	}
+
+	inline std::shared_ptr<const OccupancyGrid> getMap() const {
+		return map_ptr_;
+	}
+
+	/**
+	 * @brief Returns length (in meters) of the shortest path from the cell to the goal, infinity if unreachable
+	 */
+	double getCost(const Cell& cell) const;
+
+	inline bool isReachable(const Cell& cell) const {
+		return getCost(cell) < INF;
+	}
+
+	/**
+	 * @brief Finds the neighbour of the cell that is closest to the goal
+	 *
+	 * @return false if the cell is the goal or it is unreachable
+	 */
+	bool getNextCell(const Cell& cell, Cell& next) const;
+
+	/**
+	 * @brief Descends the field up to @ref lookahead cells starting from the @ref cell
+	 *
+	 * @details Following consecutive waypoints gives a smoother motion than moving between neighbouring cells
+	 */
+	Cell getWaypoint(const Cell& cell, int lookahead) const;
+
+	/// @brief Cost of unreachable cells
+	static const double INF;
+
+protected:
+	std::shared_ptr<const OccupancyGrid> map_ptr_;
+	Cell goal_;
+	/// Costs indexed with map cell index; float precision is enough and halves the memory footprint
+	std::vector<float> cost_;
+}; // class FlowField
+
+} // namespace hubero
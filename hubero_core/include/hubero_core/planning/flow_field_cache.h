@@ -0,0 +1,66 @@
+#pragma once
+
+#include <hubero_core/planning/flow_field.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Stores flow fields of recently requested destinations, so agents heading to the same place share one field
+ *
+ * @details Fields are identified by the map and the goal cell. Each agent typically receives its own copy
+ * of the map, hence maps are deduplicated first with @ref share. The least recently used field is dropped
+ * once the capacity is exceeded. All methods are thread-safe; fields are computed outside of the lock.
+ */
+class FlowFieldCache {
+public:
+	typedef OccupancyGrid::Cell Cell;
+
+	/// Default max number of stored fields
+	static const size_t CAPACITY_DEFAULT;
+
+	FlowFieldCache(size_t capacity = CAPACITY_DEFAULT);
+
+	/**
+	 * @brief Returns previously registered map that is identical to the given one, registers it otherwise
+	 *
+	 * @details Map returned from this method should be used in @ref get calls
+	 */
+	std::shared_ptr<const OccupancyGrid> share(std::shared_ptr<const OccupancyGrid> map_ptr);
+
+	/**
+	 * @brief Returns flow field of the goal cell, computes one if not stored yet
+	 */
+	std::shared_ptr<const FlowField> get(std::shared_ptr<const OccupancyGrid> map_ptr, const Cell& goal);
+
+	/// @brief Returns number of stored fields
+	size_t getSize() const;
+
+	/// @brief Returns number of fields computed so far
+	size_t getComputationsNum() const;
+
+	/// @brief Returns cache that is shared by all agents in the process
+	static std::shared_ptr<FlowFieldCache> getSharedCache();
+
+protected:
+	struct Entry {
+		std::shared_ptr<const FlowField> field_ptr;
+		/// Value of @ref usage_counter_ at the latest request of the field
+		uint64_t last_used;
+	};
+
+	static bool isEqual(const OccupancyGrid& a, const OccupancyGrid& b);
+
+	size_t capacity_;
+	std::vector<Entry> entries_;
+	std::vector<std::weak_ptr<const OccupancyGrid>> maps_;
+	uint64_t usage_counter_;
+	size_t computations_;
+	mutable std::mutex mutex_;
+}; // class FlowFieldCache
+
+} // namespace hubero
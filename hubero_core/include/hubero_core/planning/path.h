@@ -0,0 +1,120 @@
+#pragma once
+
+#include <hubero_common/typedefs.h>
+#include <hubero_interfaces/utils/occupancy_grid.h>
+
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Compact planar path, stored as contiguous arrays of x, y and yaw (structure of arrays)
+ *
+ * @details Planners fill the path directly from grid cells and consumers read coordinates without
+ * conversions to messages or @ref Pose3 objects. Frame changes are applied in place with @ref transform.
+ */
+class Path {
+public:
+	Path() = default;
+
+	/**
+	 * @brief Builds path through centers of the cells (expressed in the map frame)
+	 *
+	 * @details Poses are oriented along the path segments, the last one along the last segment.
+	 * @ref yaw_default is used when path consists of a single cell
+	 */
+	static Path fromCells(
+		const OccupancyGrid& map,
+		const std::vector<OccupancyGrid::Cell>& cells,
+		double yaw_default = 0.0
+	);
+
+	inline void reserve(size_t size) {
+		x_.reserve(size);
+		y_.reserve(size);
+		yaw_.reserve(size);
+	}
+
+	inline void clear() {
+		x_.clear();
+		y_.clear();
+		yaw_.clear();
+	}
+
+	inline void push_back(double x, double y, double yaw) {
+		x_.push_back(x);
+		y_.push_back(y);
+		yaw_.push_back(yaw);
+	}
+
+	inline size_t size() const {
+		return x_.size();
+	}
+
+	inline bool empty() const {
+		return x_.empty();
+	}
+
+	inline double getX(size_t i) const {
+		return x_[i];
+	}
+
+	inline double getY(size_t i) const {
+		return y_[i];
+	}
+
+	inline double getYaw(size_t i) const {
+		return yaw_[i];
+	}
+
+	/// @brief Returns the i-th pose at the given height
+	inline Pose3 getPose(size_t i, double z = 0.0) const {
+		return Pose3(x_[i], y_[i], z, 0.0, 0.0, yaw_[i]);
+	}
+
+	/// @defgroup pathdata Raw coordinate arrays, e.g., for visualization
+	/// @{
+	inline const std::vector<double>& getXs() const {
+		return x_;
+	}
+
+	inline const std::vector<double>& getYs() const {
+		return y_;
+	}
+
+	inline const std::vector<double>& getYaws() const {
+		return yaw_;
+	}
+	/// @}
+
+	/**
+	 * @brief Expresses poses in another frame, planar equivalent of `pose + transform` for each pose
+	 *
+	 * @details Only the yaw of the @ref transform rotation is taken into account
+	 */
+	void transform(const Pose3& transform);
+
+	/**
+	 * @brief Keeps every @ref step -th pose; first and last poses are always kept
+	 */
+	void decimate(size_t step);
+
+	/**
+	 * @brief Removes poses that deviate from the straight lines between the remaining ones by less than
+	 * @ref tolerance (in meters), using Ramer-Douglas-Peucker algorithm; first and last poses are always kept
+	 */
+	void simplify(double tolerance);
+
+	/// @brief Returns length (in meters) of the polyline
+	double getLength() const;
+
+protected:
+	/// Removes poses not marked to be kept
+	void filter(const std::vector<bool>& keep);
+
+	std::vector<double> x_;
+	std::vector<double> y_;
+	std::vector<double> yaw_;
+}; // class Path
+
+} // namespace hubero
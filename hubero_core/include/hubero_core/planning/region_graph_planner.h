@@ -0,0 +1,170 @@
+#pragma once
+
+#include <hubero_interfaces/utils/occupancy_grid.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Two-level planner for large occupancy grids
+ *
+ * @details The map is divided into square blocks and free cells of each block are split into connected components
+ * called regions. Adjacent regions are connected with portals (one per pair of regions, placed in the middle
+ * of their common border). The coarse graph of portals is precomputed once per map. A query first searches
+ * the coarse graph to select the corridor of regions between the start and the goal, then the fine A* search
+ * on the grid is restricted to cells of the corridor (optionally widened with neighbouring regions).
+ *
+ * @details Connectivity rules of the fine search match the ones of @ref DStarLite (8-connected grid,
+ * no corner cutting), so both planners agree on reachability.
+ *
+ * @details Region graph is immutable after @ref initialize; queries that keep their state in a separate
+ * @ref Query may be executed on the same planner from multiple threads at once.
+ */
+class RegionGraphPlanner {
+public:
+	typedef OccupancyGrid::Cell Cell;
+
+	/// Default length (in cells) of the block side
+	static const int REGION_SIZE_DEFAULT;
+
+	/// Default number of neighbouring region rings that the corridor is widened with
+	static const int CORRIDOR_MARGIN_DEFAULT;
+
+	/**
+	 * @brief State of a single query, buffers are reused by subsequent queries
+	 */
+	struct Query {
+		Query();
+
+		/// Generation of the query that the region is a part of the corridor in
+		std::vector<uint32_t> corridor_stamp;
+		std::vector<int> corridor;
+		/// Generation of the query that the cell state belongs to (cell states are invalidated lazily)
+		std::vector<uint32_t> cell_stamp;
+		std::vector<double> cell_g;
+		std::vector<size_t> cell_parent;
+		uint32_t stamp_current;
+
+		std::vector<Cell> path;
+		double path_cost;
+		size_t expansions;
+	};
+
+	RegionGraphPlanner();
+
+	/**
+	 * @brief Provides map to plan on and precomputes the region graph
+	 *
+	 * @param region_size length (in cells) of the block side
+	 */
+	void initialize(std::shared_ptr<const OccupancyGrid> map_ptr, int region_size = REGION_SIZE_DEFAULT);
+
+	bool isInitialized() const;
+
+	/**
+	 * @brief Sets how many rings of regions neighbouring the coarse corridor are included in the fine search
+	 *
+	 * @details Wider corridor gives shorter paths at the cost of more expansions
+	 */
+	void setCorridorMargin(int regions);
+
+	/**
+	 * @brief Computes path between free cells
+	 *
+	 * @return true if path exists
+	 */
+	bool plan(const Cell& start, const Cell& goal);
+
+	/**
+	 * @brief Computes path between free cells, stores results in the @ref query, does not modify the planner
+	 *
+	 * @return true if path exists
+	 */
+	bool plan(const Cell& start, const Cell& goal, Query& query) const;
+
+	/**
+	 * @brief Retrieves path computed in the latest @ref plan call (from start to goal), empty if not found
+	 */
+	std::vector<Cell> getPath() const;
+
+	/// @brief Returns cost (length in meters) of the path computed in the latest @ref plan call
+	double getPathCost() const;
+
+	/// @brief Returns the number of cell expansions performed by the fine search of the latest @ref plan call
+	size_t getExpansionsNum() const;
+
+	/// @brief Returns IDs of regions that the fine search of the latest @ref plan call was restricted to
+	std::vector<int> getCorridor() const;
+
+	/// @brief Returns region ID of the cell, -1 if cell is occupied or lies outside of the map
+	int getRegion(const Cell& cell) const;
+
+	size_t getRegionsNum() const;
+
+	size_t getPortalsNum() const;
+
+protected:
+	/// Pair of neighbouring cells located on both sides of the border between regions
+	struct Portal {
+		int region_a;
+		int region_b;
+		Cell cell_a;
+		Cell cell_b;
+	};
+
+	struct Region {
+		/// IDs of portals that lead out of the region
+		std::vector<int> portals;
+		/// IDs of adjacent regions
+		std::vector<int> neighbours;
+	};
+
+	/// Splits free cells of the block into 4-connected regions
+	void computeRegions(int block_x, int block_y);
+
+	/// Connects regions that share a border
+	void computePortals();
+
+	/**
+	 * @brief A* on the graph of portals, stores corridor of regions
+	 */
+	bool searchCorridor(const Cell& start, const Cell& goal, Query& query) const;
+
+	/// Marks regions neighbouring the corridor as its part (one ring per call)
+	void widenCorridor(Query& query) const;
+
+	/**
+	 * @brief A* on the grid restricted to the corridor, stores path
+	 */
+	bool searchPath(const Cell& start, const Cell& goal, Query& query) const;
+
+	/// Octile distance (in meters) between cells
+	inline double computeHeuristic(const Cell& from, const Cell& to) const;
+
+	/// Euclidean distance (in meters) between cells
+	inline double computeDistance(const Cell& from, const Cell& to) const;
+
+	inline bool isInCorridor(const Cell& cell, const Query& query) const;
+
+	std::shared_ptr<const OccupancyGrid> map_ptr_;
+	int region_size_;
+	int corridor_margin_;
+
+	/**
+	 * @defgroup regiongraph Precomputed region graph
+	 * @{
+	 */
+	/// Region ID of each cell, -1 for occupied cells
+	std::vector<int32_t> cell_region_;
+	std::vector<Region> regions_;
+	std::vector<Portal> portals_;
+	/// @}
+
+	/// State of the latest query executed with @ref plan that does not take the query
+	Query query_;
+}; // class RegionGraphPlanner
+
+} // namespace hubero
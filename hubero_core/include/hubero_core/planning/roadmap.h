@@ -0,0 +1,139 @@
+#pragma once
+
+#include <hubero_interfaces/utils/occupancy_grid.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Probabilistic roadmap (PRM) over the free space of the occupancy grid
+ *
+ * @details Nodes are sampled uniformly among free cells and each pair of nodes that see each other
+ * (within the connection radius) is joined with an edge. The roadmap is built once per map, then random
+ * reachable goals are drawn from the connected component of the start and path queries reduce to A* search
+ * on a graph of a few hundred nodes instead of the grid.
+ *
+ * @details Lines of sight do not cut corners of occupied cells, so straight segments between consecutive
+ * path nodes are traversable.
+ */
+class Roadmap {
+public:
+	typedef OccupancyGrid::Cell Cell;
+
+	// TODO: would look cleaner with C++17 'static constexpr'
+	/// Default number of sampled nodes
+	static const size_t NODES_NUM_DEFAULT;
+
+	/// Default max length (in cells) of the edge
+	static const int CONNECTION_RADIUS_DEFAULT;
+
+	Roadmap();
+
+	/**
+	 * @brief Samples nodes on the map and connects them
+	 *
+	 * @param nodes_num number of nodes, fewer may be sampled if the map has little free space
+	 * @param connection_radius max length (in cells) of the edge
+	 * @param seed seed of the node sampler
+	 */
+	void initialize(
+		std::shared_ptr<const OccupancyGrid> map_ptr,
+		size_t nodes_num = NODES_NUM_DEFAULT,
+		int connection_radius = CONNECTION_RADIUS_DEFAULT,
+		unsigned int seed = 0
+	);
+
+	bool isInitialized() const;
+
+	/**
+	 * @brief Returns ID of the closest node visible from the cell (within the connection radius), -1 if none
+	 */
+	int findNode(const Cell& cell) const;
+
+	/**
+	 * @brief Draws a cell of a random node that is reachable from the @ref start
+	 *
+	 * @return false if no node is visible from the @ref start
+	 */
+	bool sampleReachable(const Cell& start, std::mt19937& gen, Cell& goal) const;
+
+	/**
+	 * @brief Computes path between free cells through the roadmap
+	 *
+	 * @return true if path exists
+	 */
+	bool plan(const Cell& start, const Cell& goal);
+
+	/**
+	 * @brief Computes path between free cells through the roadmap, does not modify the roadmap
+	 *
+	 * @details Roadmap is immutable after @ref initialize, so this may be called from multiple threads at once
+	 */
+	bool plan(const Cell& start, const Cell& goal, std::vector<Cell>& path, double& cost) const;
+
+	/**
+	 * @brief Retrieves path computed in the latest @ref plan call (from start to goal), empty if not found
+	 *
+	 * @details Consecutive cells are connected with straight line segments
+	 */
+	std::vector<Cell> getPath() const;
+
+	/// @brief Returns cost (length in meters) of the path computed in the latest @ref plan call
+	double getPathCost() const;
+
+	/**
+	 * @brief Checks whether the straight segment between cells is free (corners of occupied cells are not cut)
+	 */
+	bool isVisible(const Cell& from, const Cell& to) const;
+
+	Cell getNode(int id) const;
+
+	/// @brief Returns ID of the connected component that the node belongs to
+	int getComponent(int id) const;
+
+	size_t getNodesNum() const;
+
+	size_t getEdgesNum() const;
+
+	size_t getComponentsNum() const;
+
+protected:
+	struct Edge {
+		int node;
+		/// Length in meters
+		double cost;
+	};
+
+	/// Collects nodes within the connection radius of the cell (cheaply, with the bucket grid)
+	std::vector<int> findNodesNearby(const Cell& cell) const;
+
+	/// Euclidean distance (in meters) between cells
+	inline double computeDistance(const Cell& from, const Cell& to) const;
+
+	std::shared_ptr<const OccupancyGrid> map_ptr_;
+	int connection_radius_;
+
+	std::vector<Cell> nodes_;
+	std::vector<std::vector<Edge>> edges_;
+	size_t edges_num_;
+	std::vector<int> node_component_;
+	/// IDs of nodes of each component
+	std::vector<std::vector<int>> components_;
+
+	/**
+	 * @defgroup roadmapbuckets Nodes grouped in square buckets with a side of the connection radius
+	 * @{
+	 */
+	int buckets_width_;
+	int buckets_height_;
+	std::vector<std::vector<int>> buckets_;
+	/// @}
+
+	std::vector<Cell> path_;
+	double path_cost_;
+}; // class Roadmap
+
+} // namespace hubero
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <hubero_core/planning/region_graph_planner.h>
+#include <hubero_core/planning/roadmap.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Stores planning structures prepared for the static map, so agents receiving the same map share them
+ *
+ * @details Each agent typically receives its own copy of the static map. Inflated map, region graph and roadmap
+ * are identified by the content of the received map and the parameters they are built with; they are immutable,
+ * hence agents query them with their own state (see @ref RegionGraphPlanner::Query and the const overload
+ * of @ref Roadmap::plan). Structures are kept as long as any agent uses them.
+ *
+ * @details All methods are thread-safe. Structures are built under the lock, so agents that receive the same map
+ * at once wait for a single build instead of repeating it.
+ */
+class StaticMapCache {
+public:
+	/**
+	 * @brief Parameters of the structures built for the map
+	 */
+	struct Parameters {
+		Parameters();
+
+		/// How much (in meters) obstacles are enlarged
+		double inflation_radius;
+		/// Whether the region graph is built
+		bool region_graph;
+		/// Length (in meters) of the side of the region graph block
+		double region_size;
+		/// Whether the roadmap is built
+		bool roadmap;
+		size_t roadmap_nodes;
+		/// Max length (in meters) of the roadmap edge
+		double roadmap_connection_radius;
+		/// Seed of the roadmap node sampler, fixed so that roadmaps of the same map are identical
+		unsigned int roadmap_seed;
+
+		bool operator==(const Parameters& other) const;
+	};
+
+	/**
+	 * @brief Structures prepared for the map, those not requested in @ref Parameters are null
+	 */
+	struct Products {
+		std::shared_ptr<const OccupancyGrid> map_ptr;
+		std::shared_ptr<const RegionGraphPlanner> region_planner_ptr;
+		std::shared_ptr<const Roadmap> roadmap_ptr;
+	};
+
+	StaticMapCache();
+
+	/**
+	 * @brief Returns structures previously built for an identical map and parameters, builds them otherwise
+	 *
+	 * @param map map before inflation
+	 */
+	Products get(const OccupancyGrid& map, const Parameters& params);
+
+	/// @brief Returns number of maps whose structures are stored
+	size_t getSize() const;
+
+	/// @brief Returns number of builds done so far
+	size_t getBuildsNum() const;
+
+	/// @brief Returns cache that is shared by all agents in the process
+	static std::shared_ptr<StaticMapCache> getSharedCache();
+
+protected:
+	/// Structures are held weakly, so they are released once no agent uses them
+	struct Entry {
+		/// Map before inflation
+		std::shared_ptr<const OccupancyGrid> map_src_ptr;
+		Parameters params;
+		std::weak_ptr<const OccupancyGrid> map_ptr;
+		std::weak_ptr<const RegionGraphPlanner> region_planner_ptr;
+		std::weak_ptr<const Roadmap> roadmap_ptr;
+	};
+
+	/// @brief Retrieves structures of the entry, returns false if any of the requested ones was released
+	static bool lock(const Entry& entry, Products& products);
+
+	static Products build(const OccupancyGrid& map, const Parameters& params);
+
+	static bool isEqual(const OccupancyGrid& a, const OccupancyGrid& b);
+
+	std::vector<Entry> entries_;
+	size_t builds_;
+	mutable std::mutex mutex_;
+}; // class StaticMapCache
+
+} // namespace hubero
@@ -4,11 +4,17 @@
 #include <hubero_core/tasks/task_essentials.h>
 #include <hubero_core/fsm/fsm_follow_object.h>
 
+#include <atomic>
+
 namespace hubero {
 
 class TaskFollowObject: public TaskEssentials<FsmFollowObject, FsmFollowObject::State, EventFsmFollowObject> {
 public:
-	TaskFollowObject(): TaskEssentials::TaskEssentials(TASK_FOLLOW_OBJECT) {
+	TaskFollowObject():
+		TaskEssentials::TaskEssentials(TASK_FOLLOW_OBJECT),
+		object_resolve_pending_(false),
+		object_resolve_period_(1.0)
+	{
 		task_args_num_ = countArgumentsNum(&TaskFollowObject::request);
 		state_bb_map_ = {
 			{FsmFollowObject::State::MOVING_TO_GOAL, BasicBehaviourType::BB_FOLLOW_OBJECT},
@@ -45,6 +51,8 @@ public:
 
 	virtual bool request(const std::string& object_name) override {
 		object_name_ = object_name;
+		// requests arrive from other threads than the simulation one, so the name is resolved in the next update
+		object_resolve_pending_ = true;
 		return TaskEssentials::request(object_name);
 	}
 
@@ -61,13 +69,39 @@ public:
 
 protected:
 	virtual void updateMemory() override {
-		auto object = world_geometry_ptr_->getModel(object_name_);
-		memory_ptr_->setGoal(object.getPose());
+		Pose3 object_pose;
+		bool object_found = false;
+		// name lookups are expensive, so they are performed once per request
+		bool resolve_required = object_resolve_pending_.exchange(false);
+		if (!resolve_required) {
+			object_found = world_geometry_ptr_->getModelPose(object_handle_, object_pose);
+			// object might have been deleted and spawned again or did not exist at the time of request;
+			// name lookup is linear in the number of models, hence it is not repeated in every step
+			double since_resolve = Time::computeDuration(object_resolve_time_, memory_ptr_->getTimeCurrent()).getTime();
+			resolve_required = !object_found && since_resolve >= object_resolve_period_;
+		}
+		if (resolve_required) {
+			object_handle_ = world_geometry_ptr_->resolveModel(object_name_);
+			object_resolve_time_ = memory_ptr_->getTimeCurrent();
+			object_found = world_geometry_ptr_->getModelPose(object_handle_, object_pose);
+		}
+		// goal is kept when the object disappears
+		if (object_found) {
+			memory_ptr_->setGoal(object_pose);
+		}
 		TaskEssentials::updateMemory();
 	}
 
 	/// @brief Name of the object that was requested to follow
 	std::string object_name_;
+	/// @brief Handle to the followed object, resolved in the first update after the request
+	ModelHandle object_handle_;
+	/// @brief Set by @ref request, so the handle of the newly requested object is resolved in the simulation thread
+	std::atomic<bool> object_resolve_pending_;
+	/// @brief Time of the latest name lookup of the followed object
+	Time object_resolve_time_;
+	/// @brief Min time (in seconds) between name lookups while the followed object is missing
+	double object_resolve_period_;
 }; // TaskFollowObject
 
 } // namespace hubero
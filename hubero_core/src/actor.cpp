@@ -116,6 +116,12 @@ void Actor::initialize(
 		task_talk_ptr_,
 		navigation_ptr_
 	);
+	// tracking starts from scratch, regardless of the previously tracked target
+	fsm_.addTransitionHandler(
+		FsmSuper::State::STAND,
+		FsmSuper::State::FOLLOW_OBJECT,
+		std::bind(&GoalUpdatePolicy::reset, &goal_update_policy_)
+	);
 }
 
 void Actor::update(const Time& time) {
@@ -275,30 +281,8 @@ void Actor::bbMoveToGoal() {
 }
 
 void Actor::bbFollowObject() {
-	// evaluate, if plan is outdated and re-generation is required
-	if (mem_ptr_->getTimeSinceLastGoalUpdate() >= GOAL_UPDATE_PERIOD_DEFAULT) {
-		HUBERO_LOG(
-			"[%s] Follow object goal update: '%s' currently located at {x: %2.2f, y: %2.2f}\r\n",
-			actor_sim_name_.c_str(),
-			task_follow_object_ptr_->getFollowedObjectName().c_str(),
-			// task updates goal
-			mem_ptr_->getPoseGoal().Pos().X(),
-			mem_ptr_->getPoseGoal().Pos().Y()
-		);
-		// try to find reachable pose close to the goal
-		bool goal_found = false;
-		Pose3 goal_pose;
-		std::tie(goal_found, goal_pose) = navigation_ptr_->computeClosestAchievablePose(
-			mem_ptr_->getPoseGoal(),
-			navigation_ptr_->getWorldFrame()
-		);
-		// apply new navigation goal if 'goal_pose' is valid
-		if (goal_found) {
-			mem_ptr_->setGoal(goal_pose);
-			mem_ptr_->setGoalPoseUpdateTime(mem_ptr_->getTimeCurrent());
-			navigation_ptr_->setGoal(mem_ptr_->getPoseGoal(), navigation_ptr_->getWorldFrame());
-		}
-	}
+	// pose of the followed object is stored as the goal while the task updates the memory
+	updateTrackedGoal(mem_ptr_->getPoseGoal(), task_follow_object_ptr_->getFollowedObjectName());
 
 	// process navigation command - compute displacement
 	auto pose_new = Actor::computeNewPose(
@@ -311,6 +295,42 @@ void Actor::bbFollowObject() {
 	mem_ptr_->setPose(pose_new);
 }
 
+void Actor::updateTrackedGoal(const Pose3& target_pose, const std::string& target_name) {
+	// planning from scratch is expensive, so it is not triggered as often as the incremental one
+	auto params = goal_update_policy_.getParameters();
+	params.period_min = navigation_ptr_->isIncrementalPlanningSupported()
+		? GOAL_UPDATE_PERIOD_MIN_INCREMENTAL
+		: GOAL_UPDATE_PERIOD_MIN_DEFAULT;
+	params.period_max = GOAL_UPDATE_PERIOD_DEFAULT;
+	goal_update_policy_.setParameters(params);
+
+	if (!goal_update_policy_.isUpdateRequired(target_pose, mem_ptr_->getTimeCurrent())) {
+		return;
+	}
+
+	HUBERO_LOG(
+		"[%s] Tracked goal update: '%s' currently located at {x: %2.2f, y: %2.2f}\r\n",
+		actor_sim_name_.c_str(),
+		target_name.c_str(),
+		target_pose.Pos().X(),
+		target_pose.Pos().Y()
+	);
+	// try to find reachable pose close to the target
+	bool goal_found = false;
+	Pose3 goal_pose;
+	std::tie(goal_found, goal_pose) = navigation_ptr_->computeClosestAchievablePose(
+		target_pose,
+		navigation_ptr_->getWorldFrame()
+	);
+	// apply new navigation goal if 'goal_pose' is valid
+	if (goal_found) {
+		mem_ptr_->setGoal(goal_pose);
+		mem_ptr_->setGoalPoseUpdateTime(mem_ptr_->getTimeCurrent());
+		navigation_ptr_->setGoal(mem_ptr_->getPoseGoal(), navigation_ptr_->getWorldFrame());
+		goal_update_policy_.markUpdated(target_pose, mem_ptr_->getTimeCurrent());
+	}
+}
+
 void Actor::bbChooseNewGoal() {
 	// do not trigger planning too often
 	if (mem_ptr_->getTimeSinceLastGoalUpdate() <= CHOOSE_NEW_GOAL_RETRY_PERIOD_DEFAULT) {
@@ -0,0 +1,108 @@
+#include <hubero_core/navigation/goal_prefetcher.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace hubero {
+
+const size_t GoalPrefetcher::CAPACITY_DEFAULT = 3;
+const size_t GoalPrefetcher::WORKERS_NUM_DEFAULT = 1;
+const int GoalPrefetcher::RETRY_PERIOD = 100;
+
+GoalPrefetcher::GoalPrefetcher(Sampler sampler, size_t capacity, size_t workers_num):
+	sampler_(sampler),
+	capacity_(std::max(capacity, static_cast<size_t>(1))),
+	start_valid_(false),
+	generation_(0),
+	pending_(0),
+	samples_(0),
+	stop_(false)
+{
+	for (size_t i = 0; i < std::max(workers_num, static_cast<size_t>(1)); i++) {
+		workers_.emplace_back(&GoalPrefetcher::work, this);
+	}
+}
+
+GoalPrefetcher::~GoalPrefetcher() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	cv_.notify_all();
+	for (auto& worker: workers_) {
+		worker.join();
+	}
+}
+
+void GoalPrefetcher::setStart(const Pose3& pose) {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		start_ = pose;
+		start_valid_ = true;
+		generation_++;
+		goals_.clear();
+	}
+	cv_.notify_all();
+}
+
+bool GoalPrefetcher::pop(Pose3& goal) {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (goals_.empty()) {
+			return false;
+		}
+		goal = goals_.front();
+		goals_.pop_front();
+	}
+	cv_.notify_all();
+	return true;
+}
+
+size_t GoalPrefetcher::getSize() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return goals_.size();
+}
+
+size_t GoalPrefetcher::getSamplesNum() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return samples_;
+}
+
+void GoalPrefetcher::work() {
+	std::unique_lock<std::mutex> lock(mutex_);
+	while (true) {
+		cv_.wait(lock, [this]() {
+			return stop_ || (start_valid_ && goals_.size() + pending_ < capacity_);
+		});
+		if (stop_) {
+			return;
+		}
+
+		// sampler runs without the lock, so other workers and the simulation thread are not blocked
+		auto start = start_;
+		auto generation = generation_;
+		pending_++;
+		lock.unlock();
+		bool valid = false;
+		Pose3 goal;
+		std::tie(valid, goal) = sampler_(start);
+		lock.lock();
+		pending_--;
+		samples_++;
+
+		if (generation != generation_) {
+			// start has changed in the meantime
+			continue;
+		}
+		if (valid) {
+			goals_.push_back(goal);
+			continue;
+		}
+		// avoid spinning when no goal can be found from the current start
+		cv_.wait_for(lock, std::chrono::milliseconds(RETRY_PERIOD), [this, generation]() {
+			return stop_ || generation != generation_;
+		});
+	}
+}
+
+} // namespace hubero
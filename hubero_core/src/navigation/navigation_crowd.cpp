@@ -0,0 +1,46 @@
+#include <hubero_core/navigation/navigation_crowd.h>
+
+namespace hubero {
+
+NavigationCrowd::NavigationCrowd(std::shared_ptr<NavigationBase> nav_ptr, std::shared_ptr<OrcaSolver> solver_ptr):
+	NavigationDecorator(nav_ptr),
+	solver_ptr_(solver_ptr != nullptr ? solver_ptr : NavigationCrowd::getSharedSolver()),
+	agent_id_(solver_ptr_->addAgent()),
+	updated_since_query_(false)
+{}
+
+NavigationCrowd::~NavigationCrowd() {
+	solver_ptr_->removeAgent(agent_id_);
+}
+
+void NavigationCrowd::update(const Pose3& pose, const Vector3& vel_lin, const Vector3& vel_ang) {
+	nav_ptr_->update(pose, vel_lin, vel_ang);
+	solver_ptr_->updateAgent(agent_id_, pose.Pos(), vel_lin, nav_ptr_->getVelocityCmd());
+	updated_since_query_ = true;
+}
+
+Vector3 NavigationCrowd::getVelocityCmd() const {
+	// command may be requested multiple times during a single step, solver is asked only once per update
+	if (!updated_since_query_) {
+		return cmd_vel_;
+	}
+	updated_since_query_ = false;
+
+	auto cmd_pref = nav_ptr_->getVelocityCmd();
+	// do not push actors that do not want to move
+	if (cmd_pref.X() == 0.0 && cmd_pref.Y() == 0.0) {
+		cmd_vel_ = cmd_pref;
+		return cmd_vel_;
+	}
+	auto vel = solver_ptr_->getVelocity(agent_id_);
+	cmd_vel_ = Vector3(vel.X(), vel.Y(), cmd_pref.Z());
+	return cmd_vel_;
+}
+
+// static
+std::shared_ptr<OrcaSolver> NavigationCrowd::getSharedSolver() {
+	static std::shared_ptr<OrcaSolver> solver_ptr(std::make_shared<OrcaSolver>());
+	return solver_ptr;
+}
+
+} // namespace hubero
@@ -0,0 +1,396 @@
+#include <hubero_core/navigation/orca_solver.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace hubero {
+
+/// Threshold below which lines are considered parallel
+static const double ORCA_EPSILON = 1e-05;
+
+/// Preferred speed below which the agent is considered idle
+static const double ORCA_IDLE_SPEED = 1e-03;
+
+static inline double det(double ax, double ay, double bx, double by) {
+	return ax * by - ay * bx;
+}
+
+OrcaSolver::OrcaSolver() {}
+
+void OrcaSolver::setParameters(const Parameters& params) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	params_ = params;
+}
+
+OrcaSolver::Parameters OrcaSolver::getParameters() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return params_;
+}
+
+size_t OrcaSolver::addAgent() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	// reuse slot of the agent that was removed
+	auto it = std::find(registered_.begin(), registered_.end(), 0);
+	if (it != registered_.end()) {
+		size_t id = std::distance(registered_.begin(), it);
+		registered_[id] = 1;
+		active_[id] = 0;
+		idle_[id] = 1;
+		consumed_[id] = 1;
+		return id;
+	}
+
+	pos_x_.push_back(0.0);
+	pos_y_.push_back(0.0);
+	vel_x_.push_back(0.0);
+	vel_y_.push_back(0.0);
+	vel_pref_x_.push_back(0.0);
+	vel_pref_y_.push_back(0.0);
+	vel_new_x_.push_back(0.0);
+	vel_new_y_.push_back(0.0);
+	registered_.push_back(1);
+	active_.push_back(0);
+	idle_.push_back(1);
+	// enforces solve on the first request
+	consumed_.push_back(1);
+	dist_sq_.push_back(0.0);
+	return registered_.size() - 1;
+}
+
+void OrcaSolver::removeAgent(size_t id) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (id >= registered_.size()) {
+		return;
+	}
+	registered_[id] = 0;
+	active_[id] = 0;
+}
+
+void OrcaSolver::updateAgent(size_t id, const Vector3& pos, const Vector3& vel, const Vector3& vel_pref) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (id >= registered_.size() || !registered_[id]) {
+		return;
+	}
+	pos_x_[id] = pos.X();
+	pos_y_[id] = pos.Y();
+	vel_x_[id] = vel.X();
+	vel_y_[id] = vel.Y();
+	vel_pref_x_[id] = vel_pref.X();
+	vel_pref_y_[id] = vel_pref.Y();
+	active_[id] = 1;
+	idle_[id] = (vel_pref.X() * vel_pref.X() + vel_pref.Y() * vel_pref.Y()) < (ORCA_IDLE_SPEED * ORCA_IDLE_SPEED);
+}
+
+Vector3 OrcaSolver::getVelocity(size_t id) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (id >= registered_.size() || !active_[id]) {
+		return Vector3();
+	}
+	// result of the newest solve was already taken by this agent - new round has started
+	if (consumed_[id]) {
+		for (size_t i = 0; i < active_.size(); i++) {
+			solveAgent(i);
+		}
+		std::fill(consumed_.begin(), consumed_.end(), 0);
+	}
+	consumed_[id] = 1;
+	return Vector3(vel_new_x_[id], vel_new_y_[id], 0.0);
+}
+
+void OrcaSolver::solve() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	for (size_t i = 0; i < active_.size(); i++) {
+		solveAgent(i);
+	}
+	std::fill(consumed_.begin(), consumed_.end(), 0);
+}
+
+size_t OrcaSolver::getAgentsNum() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return std::count(active_.begin(), active_.end(), 1);
+}
+
+void OrcaSolver::solveAgent(size_t i) {
+	if (!active_[i]) {
+		return;
+	}
+
+	const size_t n = active_.size();
+	const double range_sq = params_.neighbour_distance * params_.neighbour_distance;
+	const double inf = std::numeric_limits<double>::infinity();
+
+	// batched pass over contiguous arrays - distances to all agents, invalid ones are masked out with infinity
+	const double px = pos_x_[i];
+	const double py = pos_y_[i];
+	const double* __restrict__ pos_x = pos_x_.data();
+	const double* __restrict__ pos_y = pos_y_.data();
+	const uint8_t* __restrict__ active = active_.data();
+	double* __restrict__ dist_sq = dist_sq_.data();
+	for (size_t j = 0; j < n; j++) {
+		double dx = pos_x[j] - px;
+		double dy = pos_y[j] - py;
+		double d = dx * dx + dy * dy;
+		dist_sq[j] = (active[j] && d < range_sq) ? d : inf;
+	}
+	dist_sq[i] = inf;
+
+	// collect neighbours, keep only the nearest ones
+	neighbours_.clear();
+	for (size_t j = 0; j < n; j++) {
+		if (dist_sq[j] != inf) {
+			neighbours_.push_back(j);
+		}
+	}
+	if (neighbours_.size() > params_.max_neighbours) {
+		std::nth_element(
+			neighbours_.begin(),
+			neighbours_.begin() + params_.max_neighbours,
+			neighbours_.end(),
+			[&](size_t a, size_t b) { return dist_sq[a] < dist_sq[b]; }
+		);
+		neighbours_.resize(params_.max_neighbours);
+	}
+
+	lines_.clear();
+	for (const auto& j: neighbours_) {
+		lines_.push_back(computeOrcaLine(i, j));
+	}
+
+	// preferred speed may exceed the configured limit, e.g. while running
+	double max_speed = std::max(
+		params_.max_speed,
+		std::sqrt(vel_pref_x_[i] * vel_pref_x_[i] + vel_pref_y_[i] * vel_pref_y_[i])
+	);
+
+	double result_x = 0.0;
+	double result_y = 0.0;
+	size_t line_fail = linearProgram2(lines_, max_speed, vel_pref_x_[i], vel_pref_y_[i], false, result_x, result_y);
+	if (line_fail < lines_.size()) {
+		linearProgram3(lines_, line_fail, max_speed, result_x, result_y, proj_lines_);
+	}
+	vel_new_x_[i] = result_x;
+	vel_new_y_[i] = result_y;
+}
+
+OrcaSolver::Line OrcaSolver::computeOrcaLine(size_t i, size_t j) const {
+	const double rel_pos_x = pos_x_[j] - pos_x_[i];
+	const double rel_pos_y = pos_y_[j] - pos_y_[i];
+	const double rel_vel_x = vel_x_[i] - vel_x_[j];
+	const double rel_vel_y = vel_y_[i] - vel_y_[j];
+	const double dist_sq = rel_pos_x * rel_pos_x + rel_pos_y * rel_pos_y;
+	const double combined_radius = 2.0 * params_.radius;
+	const double combined_radius_sq = combined_radius * combined_radius;
+	// idle agents do not cooperate, so the whole avoidance effort is taken by the moving one
+	const double responsibility = idle_[j] ? 1.0 : 0.5;
+
+	Line line {};
+	double u_x = 0.0;
+	double u_y = 0.0;
+
+	if (dist_sq > combined_radius_sq) {
+		// no collision
+		const double inv_time_horizon = 1.0 / params_.time_horizon;
+		// vector from cutoff center to relative velocity
+		const double w_x = rel_vel_x - inv_time_horizon * rel_pos_x;
+		const double w_y = rel_vel_y - inv_time_horizon * rel_pos_y;
+		const double w_length_sq = w_x * w_x + w_y * w_y;
+		const double dot_product1 = w_x * rel_pos_x + w_y * rel_pos_y;
+
+		if (dot_product1 < 0.0 && dot_product1 * dot_product1 > combined_radius_sq * w_length_sq) {
+			// project on cut-off circle
+			const double w_length = std::sqrt(w_length_sq);
+			const double unit_w_x = w_x / w_length;
+			const double unit_w_y = w_y / w_length;
+			line.dx = unit_w_y;
+			line.dy = -unit_w_x;
+			u_x = (combined_radius * inv_time_horizon - w_length) * unit_w_x;
+			u_y = (combined_radius * inv_time_horizon - w_length) * unit_w_y;
+		} else {
+			// project on legs
+			const double leg = std::sqrt(dist_sq - combined_radius_sq);
+			if (det(rel_pos_x, rel_pos_y, w_x, w_y) > 0.0) {
+				// left leg
+				line.dx = (rel_pos_x * leg - rel_pos_y * combined_radius) / dist_sq;
+				line.dy = (rel_pos_x * combined_radius + rel_pos_y * leg) / dist_sq;
+			} else {
+				// right leg
+				line.dx = -(rel_pos_x * leg + rel_pos_y * combined_radius) / dist_sq;
+				line.dy = -(-rel_pos_x * combined_radius + rel_pos_y * leg) / dist_sq;
+			}
+			const double dot_product2 = rel_vel_x * line.dx + rel_vel_y * line.dy;
+			u_x = dot_product2 * line.dx - rel_vel_x;
+			u_y = dot_product2 * line.dy - rel_vel_y;
+		}
+	} else {
+		// collision - project on cut-off circle of the time step
+		const double inv_time_step = 1.0 / params_.time_step;
+		const double w_x = rel_vel_x - inv_time_step * rel_pos_x;
+		const double w_y = rel_vel_y - inv_time_step * rel_pos_y;
+		const double w_length = std::max(std::sqrt(w_x * w_x + w_y * w_y), ORCA_EPSILON);
+		const double unit_w_x = w_x / w_length;
+		const double unit_w_y = w_y / w_length;
+		line.dx = unit_w_y;
+		line.dy = -unit_w_x;
+		u_x = (combined_radius * inv_time_step - w_length) * unit_w_x;
+		u_y = (combined_radius * inv_time_step - w_length) * unit_w_y;
+	}
+
+	line.px = vel_x_[i] + responsibility * u_x;
+	line.py = vel_y_[i] + responsibility * u_y;
+	return line;
+}
+
+// static
+bool OrcaSolver::linearProgram1(
+	const std::vector<Line>& lines,
+	size_t line_no,
+	double radius,
+	double opt_x,
+	double opt_y,
+	bool direction_opt,
+	double& result_x,
+	double& result_y
+) {
+	const Line& ln = lines[line_no];
+	const double dot_product = ln.px * ln.dx + ln.py * ln.dy;
+	const double discriminant = dot_product * dot_product + radius * radius - (ln.px * ln.px + ln.py * ln.py);
+	if (discriminant < 0.0) {
+		// max speed circle fully invalidates line
+		return false;
+	}
+
+	const double sqrt_discriminant = std::sqrt(discriminant);
+	double t_left = -dot_product - sqrt_discriminant;
+	double t_right = -dot_product + sqrt_discriminant;
+
+	for (size_t i = 0; i < line_no; i++) {
+		const double denominator = det(ln.dx, ln.dy, lines[i].dx, lines[i].dy);
+		const double numerator = det(lines[i].dx, lines[i].dy, ln.px - lines[i].px, ln.py - lines[i].py);
+		if (std::abs(denominator) <= ORCA_EPSILON) {
+			// lines are (almost) parallel
+			if (numerator < 0.0) {
+				return false;
+			}
+			continue;
+		}
+		const double t = numerator / denominator;
+		if (denominator >= 0.0) {
+			t_right = std::min(t_right, t);
+		} else {
+			t_left = std::max(t_left, t);
+		}
+		if (t_left > t_right) {
+			return false;
+		}
+	}
+
+	double t = 0.0;
+	if (direction_opt) {
+		t = (opt_x * ln.dx + opt_y * ln.dy > 0.0) ? t_right : t_left;
+	} else {
+		t = ln.dx * (opt_x - ln.px) + ln.dy * (opt_y - ln.py);
+		t = std::min(std::max(t, t_left), t_right);
+	}
+	result_x = ln.px + t * ln.dx;
+	result_y = ln.py + t * ln.dy;
+	return true;
+}
+
+// static
+size_t OrcaSolver::linearProgram2(
+	const std::vector<Line>& lines,
+	double radius,
+	double opt_x,
+	double opt_y,
+	bool direction_opt,
+	double& result_x,
+	double& result_y
+) {
+	const double opt_length_sq = opt_x * opt_x + opt_y * opt_y;
+	if (direction_opt) {
+		// optimize direction - the optimization vector is of unit length in this case
+		result_x = opt_x * radius;
+		result_y = opt_y * radius;
+	} else if (opt_length_sq > radius * radius) {
+		const double opt_length = std::sqrt(opt_length_sq);
+		result_x = opt_x / opt_length * radius;
+		result_y = opt_y / opt_length * radius;
+	} else {
+		result_x = opt_x;
+		result_y = opt_y;
+	}
+
+	for (size_t i = 0; i < lines.size(); i++) {
+		if (det(lines[i].dx, lines[i].dy, lines[i].px - result_x, lines[i].py - result_y) > 0.0) {
+			// result does not satisfy constraint i - compute new optimal result
+			double temp_x = result_x;
+			double temp_y = result_y;
+			if (!linearProgram1(lines, i, radius, opt_x, opt_y, direction_opt, result_x, result_y)) {
+				result_x = temp_x;
+				result_y = temp_y;
+				return i;
+			}
+		}
+	}
+	return lines.size();
+}
+
+// static
+void OrcaSolver::linearProgram3(
+	const std::vector<Line>& lines,
+	size_t begin_line,
+	double radius,
+	double& result_x,
+	double& result_y,
+	std::vector<Line>& proj_lines
+) {
+	double distance = 0.0;
+	for (size_t i = begin_line; i < lines.size(); i++) {
+		if (det(lines[i].dx, lines[i].dy, lines[i].px - result_x, lines[i].py - result_y) <= distance) {
+			continue;
+		}
+		// result does not satisfy constraint of line i
+		proj_lines.clear();
+		for (size_t j = 0; j < i; j++) {
+			Line line {};
+			const double determinant = det(lines[i].dx, lines[i].dy, lines[j].dx, lines[j].dy);
+			if (std::abs(determinant) <= ORCA_EPSILON) {
+				// line i and line j are parallel
+				if (lines[i].dx * lines[j].dx + lines[i].dy * lines[j].dy > 0.0) {
+					// same direction
+					continue;
+				}
+				// opposite direction
+				line.px = 0.5 * (lines[i].px + lines[j].px);
+				line.py = 0.5 * (lines[i].py + lines[j].py);
+			} else {
+				const double t = det(
+					lines[j].dx,
+					lines[j].dy,
+					lines[i].px - lines[j].px,
+					lines[i].py - lines[j].py
+				) / determinant;
+				line.px = lines[i].px + t * lines[i].dx;
+				line.py = lines[i].py + t * lines[i].dy;
+			}
+			const double dir_x = lines[j].dx - lines[i].dx;
+			const double dir_y = lines[j].dy - lines[i].dy;
+			const double dir_length = std::sqrt(dir_x * dir_x + dir_y * dir_y);
+			line.dx = dir_x / dir_length;
+			line.dy = dir_y / dir_length;
+			proj_lines.push_back(line);
+		}
+
+		double temp_x = result_x;
+		double temp_y = result_y;
+		if (linearProgram2(proj_lines, radius, -lines[i].dy, lines[i].dx, true, result_x, result_y) < proj_lines.size()) {
+			// should not happen in principle - the result is by definition already in the feasible region
+			result_x = temp_x;
+			result_y = temp_y;
+		}
+		distance = det(lines[i].dx, lines[i].dy, lines[i].px - result_x, lines[i].py - result_y);
+	}
+}
+
+} // namespace hubero
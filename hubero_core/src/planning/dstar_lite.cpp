@@ -0,0 +1,328 @@
+#include <hubero_core/planning/dstar_lite.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace hubero {
+
+const int DStarLite::REROOT_DISTANCE_DEFAULT = 20;
+
+static const double DSTAR_INF = std::numeric_limits<double>::infinity();
+static const double DSTAR_SQRT2 = 1.4142135623730951;
+/// Tolerance (in meters) of key comparisons; cells on the optimal path tie with the target in theory
+static const double DSTAR_KEY_TOLERANCE = 1e-06;
+
+/// 8-connected neighbourhood
+static const int DSTAR_NEIGHBOURS_NUM = 8;
+static const int DSTAR_NEIGHBOURS_DX[DSTAR_NEIGHBOURS_NUM] = {1, -1, 0, 0, 1, 1, -1, -1};
+static const int DSTAR_NEIGHBOURS_DY[DSTAR_NEIGHBOURS_NUM] = {0, 0, 1, -1, 1, -1, 1, -1};
+
+DStarLite::DStarLite():
+	reroot_distance_(REROOT_DISTANCE_DEFAULT),
+	search_valid_(false),
+	km_(0.0),
+	stamp_current_(0),
+	expansions_(0)
+{}
+
+void DStarLite::initialize(std::shared_ptr<const OccupancyGrid> map_ptr) {
+	map_ptr_ = map_ptr;
+	map_modified_ptr_.reset();
+	search_valid_ = false;
+	if (map_ptr_ == nullptr) {
+		return;
+	}
+	size_t cells = map_ptr_->getData().size();
+	g_.assign(cells, DSTAR_INF);
+	rhs_.assign(cells, DSTAR_INF);
+	key_.assign(cells, Key {DSTAR_INF, DSTAR_INF});
+	in_queue_.assign(cells, 0);
+	stamp_.assign(cells, 0);
+	stamp_current_ = 0;
+}
+
+bool DStarLite::isInitialized() const {
+	return map_ptr_ != nullptr && map_ptr_->isValid();
+}
+
+void DStarLite::setRerootDistance(int cells) {
+	reroot_distance_ = cells;
+}
+
+bool DStarLite::plan(const Cell& agent, const Cell& target) {
+	expansions_ = 0;
+	if (!isInitialized() || map_ptr_->isOccupied(agent) || map_ptr_->isOccupied(target)) {
+		return false;
+	}
+
+	bool agent_drifted = std::max(std::abs(agent.x - root_.x), std::abs(agent.y - root_.y)) > reroot_distance_;
+	if (!search_valid_ || agent_drifted) {
+		reset(agent);
+		target_last_ = target;
+	}
+
+	// target plays role of the D* Lite start, so its displacement is compensated with the key modifier
+	target_ = target;
+	if (target_ != target_last_) {
+		km_ += computeHeuristic(target_last_, target_);
+		target_last_ = target_;
+	}
+
+	computeShortestPath();
+	return getG(map_ptr_->getIndex(target_.x, target_.y)) < DSTAR_INF;
+}
+
+void DStarLite::updateCell(const Cell& cell, bool occupied) {
+	if (!isInitialized() || !map_ptr_->isInside(cell.x, cell.y)) {
+		return;
+	}
+	if (map_ptr_->isOccupied(cell) == occupied) {
+		return;
+	}
+	if (map_modified_ptr_ == nullptr) {
+		map_modified_ptr_ = std::make_shared<OccupancyGrid>(*map_ptr_);
+		map_ptr_ = map_modified_ptr_;
+	}
+	map_modified_ptr_->setOccupied(cell.x, cell.y, occupied);
+
+	if (!search_valid_) {
+		return;
+	}
+	// costs of edges incident to the cell and of diagonal edges passing its corners changed
+	for (int dy = -1; dy <= 1; dy++) {
+		for (int dx = -1; dx <= 1; dx++) {
+			Cell c(cell.x + dx, cell.y + dy);
+			if (!map_ptr_->isInside(c.x, c.y)) {
+				continue;
+			}
+			size_t index = map_ptr_->getIndex(c.x, c.y);
+			touch(index);
+			if (c != root_) {
+				updateRhs(index);
+			}
+			updateVertex(index);
+		}
+	}
+}
+
+std::vector<DStarLite::Cell> DStarLite::getPath() const {
+	std::vector<Cell> path;
+	if (!search_valid_ || getG(map_ptr_->getIndex(target_.x, target_.y)) == DSTAR_INF) {
+		return path;
+	}
+
+	// descend from the target towards the root
+	Cell current = target_;
+	path.push_back(current);
+	size_t steps_max = map_ptr_->getData().size();
+	while (current != root_ && path.size() <= steps_max) {
+		Cell best = current;
+		double best_cost = DSTAR_INF;
+		for (int i = 0; i < DSTAR_NEIGHBOURS_NUM; i++) {
+			Cell next(current.x + DSTAR_NEIGHBOURS_DX[i], current.y + DSTAR_NEIGHBOURS_DY[i]);
+			if (!map_ptr_->isInside(next.x, next.y)) {
+				continue;
+			}
+			double cost = computeCost(current, next) + getG(map_ptr_->getIndex(next.x, next.y));
+			if (cost < best_cost) {
+				best_cost = cost;
+				best = next;
+			}
+		}
+		if (best_cost == DSTAR_INF) {
+			return std::vector<Cell>();
+		}
+		current = best;
+		path.push_back(current);
+	}
+	std::reverse(path.begin(), path.end());
+	return path;
+}
+
+double DStarLite::getPathCost() const {
+	if (!search_valid_) {
+		return DSTAR_INF;
+	}
+	return getG(map_ptr_->getIndex(target_.x, target_.y));
+}
+
+size_t DStarLite::getExpansionsNum() const {
+	return expansions_;
+}
+
+DStarLite::Cell DStarLite::getRoot() const {
+	return root_;
+}
+
+void DStarLite::reset(const Cell& root) {
+	// invalidates states of all cells at once
+	stamp_current_++;
+	queue_ = std::priority_queue<QueueEntry>();
+	km_ = 0.0;
+	root_ = root;
+	search_valid_ = true;
+
+	size_t index = map_ptr_->getIndex(root.x, root.y);
+	touch(index);
+	rhs_[index] = 0.0;
+	updateVertex(index);
+}
+
+inline void DStarLite::touch(size_t index) {
+	if (stamp_[index] == stamp_current_) {
+		return;
+	}
+	stamp_[index] = stamp_current_;
+	g_[index] = DSTAR_INF;
+	rhs_[index] = DSTAR_INF;
+	in_queue_[index] = 0;
+}
+
+inline double DStarLite::getG(size_t index) const {
+	return stamp_[index] == stamp_current_ ? g_[index] : DSTAR_INF;
+}
+
+inline double DStarLite::getRhs(size_t index) const {
+	return stamp_[index] == stamp_current_ ? rhs_[index] : DSTAR_INF;
+}
+
+inline double DStarLite::computeHeuristic(const Cell& from, const Cell& to) const {
+	double dx = static_cast<double>(std::abs(from.x - to.x));
+	double dy = static_cast<double>(std::abs(from.y - to.y));
+	double res = static_cast<double>(map_ptr_->getResolution());
+	return res * ((dx + dy) + (DSTAR_SQRT2 - 2.0) * std::min(dx, dy));
+}
+
+inline DStarLite::Key DStarLite::computeKey(size_t index) const {
+	double g_rhs = std::min(getG(index), getRhs(index));
+	return Key {g_rhs + computeHeuristic(target_, map_ptr_->getCell(index)) + km_, g_rhs};
+}
+
+double DStarLite::computeCost(const Cell& from, const Cell& to) const {
+	if (map_ptr_->isOccupied(from) || map_ptr_->isOccupied(to)) {
+		return DSTAR_INF;
+	}
+	double res = static_cast<double>(map_ptr_->getResolution());
+	if (from.x == to.x || from.y == to.y) {
+		return res;
+	}
+	// diagonal move cannot cut corners
+	if (map_ptr_->isOccupied(from.x, to.y) || map_ptr_->isOccupied(to.x, from.y)) {
+		return DSTAR_INF;
+	}
+	return DSTAR_SQRT2 * res;
+}
+
+void DStarLite::updateRhs(size_t index) {
+	Cell cell = map_ptr_->getCell(index);
+	double rhs = DSTAR_INF;
+	for (int i = 0; i < DSTAR_NEIGHBOURS_NUM; i++) {
+		Cell next(cell.x + DSTAR_NEIGHBOURS_DX[i], cell.y + DSTAR_NEIGHBOURS_DY[i]);
+		if (!map_ptr_->isInside(next.x, next.y)) {
+			continue;
+		}
+		rhs = std::min(rhs, computeCost(cell, next) + getG(map_ptr_->getIndex(next.x, next.y)));
+	}
+	rhs_[index] = rhs;
+}
+
+void DStarLite::updateVertex(size_t index) {
+	bool consistent = g_[index] == rhs_[index];
+	if (!consistent) {
+		Key key = computeKey(index);
+		// enqueue or update; the previous entry (if any) becomes stale
+		if (!in_queue_[index] || !(key_[index] == key)) {
+			key_[index] = key;
+			in_queue_[index] = 1;
+			queue_.push(QueueEntry {key, index});
+		}
+	} else {
+		in_queue_[index] = 0;
+	}
+}
+
+bool DStarLite::isKeyLessOrTied(const Key& key, const Key& ref) {
+	if (key.k1 < ref.k1 - DSTAR_KEY_TOLERANCE) {
+		return true;
+	}
+	return key.k1 <= ref.k1 + DSTAR_KEY_TOLERANCE && key.k2 < ref.k2;
+}
+
+bool DStarLite::cleanQueueTop() {
+	while (!queue_.empty()) {
+		const auto& top = queue_.top();
+		if (stamp_[top.index] == stamp_current_ && in_queue_[top.index] && key_[top.index] == top.key) {
+			return true;
+		}
+		queue_.pop();
+	}
+	return false;
+}
+
+void DStarLite::computeShortestPath() {
+	size_t target_index = map_ptr_->getIndex(target_.x, target_.y);
+	touch(target_index);
+
+	while (cleanQueueTop()) {
+		QueueEntry top = queue_.top();
+		if (!isKeyLessOrTied(top.key, computeKey(target_index)) && rhs_[target_index] == g_[target_index]) {
+			break;
+		}
+		size_t u = top.index;
+		Key key_new = computeKey(u);
+		expansions_++;
+
+		if (top.key < key_new) {
+			// key got outdated since the target moved
+			queue_.pop();
+			key_[u] = key_new;
+			queue_.push(QueueEntry {key_new, u});
+			continue;
+		}
+
+		queue_.pop();
+		in_queue_[u] = 0;
+		Cell cell_u = map_ptr_->getCell(u);
+
+		if (g_[u] > rhs_[u]) {
+			// overconsistent - settle and propagate decrease
+			g_[u] = rhs_[u];
+			for (int i = 0; i < DSTAR_NEIGHBOURS_NUM; i++) {
+				Cell s(cell_u.x + DSTAR_NEIGHBOURS_DX[i], cell_u.y + DSTAR_NEIGHBOURS_DY[i]);
+				if (!map_ptr_->isInside(s.x, s.y)) {
+					continue;
+				}
+				size_t index_s = map_ptr_->getIndex(s.x, s.y);
+				touch(index_s);
+				if (s != root_) {
+					rhs_[index_s] = std::min(rhs_[index_s], computeCost(s, cell_u) + g_[u]);
+				}
+				updateVertex(index_s);
+			}
+		} else {
+			// underconsistent - invalidate and propagate increase
+			double g_old = g_[u];
+			g_[u] = DSTAR_INF;
+			for (int i = 0; i <= DSTAR_NEIGHBOURS_NUM; i++) {
+				// the last iteration handles the cell itself
+				Cell s = (i == DSTAR_NEIGHBOURS_NUM)
+					? cell_u
+					: Cell(cell_u.x + DSTAR_NEIGHBOURS_DX[i], cell_u.y + DSTAR_NEIGHBOURS_DY[i]);
+				if (!map_ptr_->isInside(s.x, s.y)) {
+					continue;
+				}
+				size_t index_s = map_ptr_->getIndex(s.x, s.y);
+				touch(index_s);
+				double cost = (s == cell_u) ? 0.0 : computeCost(s, cell_u);
+				if (s != root_ && (s == cell_u || rhs_[index_s] == cost + g_old)) {
+					updateRhs(index_s);
+				}
+				updateVertex(index_s);
+			}
+		}
+	}
+}
+
+} // namespace hubero
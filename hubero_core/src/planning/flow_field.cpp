@@ -0,0 +1,117 @@
+#include <hubero_core/planning/flow_field.h>
+
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace hubero {
+
+const double FlowField::INF = std::numeric_limits<double>::infinity();
+
+static const double FLOW_FIELD_SQRT2 = 1.4142135623730951;
+
+/// 8-connected neighbourhood
+static const int FLOW_FIELD_NEIGHBOURS_NUM = 8;
+static const int FLOW_FIELD_NEIGHBOURS_DX[FLOW_FIELD_NEIGHBOURS_NUM] = {1, -1, 0, 0, 1, 1, -1, -1};
+static const int FLOW_FIELD_NEIGHBOURS_DY[FLOW_FIELD_NEIGHBOURS_NUM] = {0, 0, 1, -1, 1, -1, 1, -1};
+
+/// Returns true if the move between neighbouring cells is allowed (no corner cutting)
+static bool isMoveAllowed(const OccupancyGrid& map, const OccupancyGrid::Cell& from, int dx, int dy) {
+	if (map.isOccupied(from.x + dx, from.y + dy)) {
+		return false;
+	}
+	return dx == 0 || dy == 0 || (!map.isOccupied(from.x + dx, from.y) && !map.isOccupied(from.x, from.y + dy));
+}
+
+FlowField::FlowField(std::shared_ptr<const OccupancyGrid> map_ptr, const Cell& goal):
+	map_ptr_(map_ptr),
+	goal_(goal)
+{
+	if (map_ptr_ == nullptr) {
+		return;
+	}
+	const auto& map = *map_ptr_;
+	cost_.assign(map.getData().size(), std::numeric_limits<float>::infinity());
+	if (map.isOccupied(goal_)) {
+		return;
+	}
+
+	// costs are accumulated in double precision and stored as floats
+	std::vector<double> cost(cost_.size(), INF);
+	typedef std::pair<double, size_t> Entry;
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+	size_t index_goal = map.getIndex(goal_.x, goal_.y);
+	cost[index_goal] = 0.0;
+	queue.push({0.0, index_goal});
+
+	while (!queue.empty()) {
+		auto top = queue.top();
+		queue.pop();
+		if (top.first > cost[top.second]) {
+			// stale entry
+			continue;
+		}
+		Cell cell = map.getCell(top.second);
+		// moves are symmetric, so expanding from the goal gives costs to the goal
+		for (int i = 0; i < FLOW_FIELD_NEIGHBOURS_NUM; i++) {
+			int dx = FLOW_FIELD_NEIGHBOURS_DX[i];
+			int dy = FLOW_FIELD_NEIGHBOURS_DY[i];
+			if (!isMoveAllowed(map, cell, dx, dy)) {
+				continue;
+			}
+			double cost_next = top.first + map.getResolution() * ((dx != 0 && dy != 0) ? FLOW_FIELD_SQRT2 : 1.0);
+			size_t index_next = map.getIndex(cell.x + dx, cell.y + dy);
+			if (cost_next < cost[index_next]) {
+				cost[index_next] = cost_next;
+				queue.push({cost_next, index_next});
+			}
+		}
+	}
+
+	for (size_t i = 0; i < cost.size(); i++) {
+		cost_[i] = static_cast<float>(cost[i]);
+	}
+}
+
+bool FlowField::isValid() const {
+	return map_ptr_ != nullptr && !map_ptr_->isOccupied(goal_);
+}
+
+double FlowField::getCost(const Cell& cell) const {
+	if (map_ptr_ == nullptr || !map_ptr_->isInside(cell.x, cell.y)) {
+		return INF;
+	}
+	return cost_[map_ptr_->getIndex(cell.x, cell.y)];
+}
+
+bool FlowField::getNextCell(const Cell& cell, Cell& next) const {
+	double cost_min = getCost(cell);
+	if (cost_min == INF || cell == goal_) {
+		return false;
+	}
+	bool found = false;
+	for (int i = 0; i < FLOW_FIELD_NEIGHBOURS_NUM; i++) {
+		int dx = FLOW_FIELD_NEIGHBOURS_DX[i];
+		int dy = FLOW_FIELD_NEIGHBOURS_DY[i];
+		Cell candidate(cell.x + dx, cell.y + dy);
+		double cost = getCost(candidate);
+		if (cost < cost_min && isMoveAllowed(*map_ptr_, cell, dx, dy)) {
+			cost_min = cost;
+			next = candidate;
+			found = true;
+		}
+	}
+	return found;
+}
+
+FlowField::Cell FlowField::getWaypoint(const Cell& cell, int lookahead) const {
+	Cell waypoint = cell;
+	Cell next;
+	for (int i = 0; i < lookahead && getNextCell(waypoint, next); i++) {
+		waypoint = next;
+	}
+	return waypoint;
+}
+
+} // namespace hubero
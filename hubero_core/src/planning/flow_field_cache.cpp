@@ -0,0 +1,106 @@
+#include <hubero_core/planning/flow_field_cache.h>
+
+#include <algorithm>
+
+namespace hubero {
+
+// TODO: would look cleaner with C++17 'static constexpr'
+const size_t FlowFieldCache::CAPACITY_DEFAULT = 16;
+
+FlowFieldCache::FlowFieldCache(size_t capacity):
+	capacity_(std::max(capacity, static_cast<size_t>(1))),
+	usage_counter_(0),
+	computations_(0)
+{}
+
+std::shared_ptr<const OccupancyGrid> FlowFieldCache::share(std::shared_ptr<const OccupancyGrid> map_ptr) {
+	if (map_ptr == nullptr) {
+		return map_ptr;
+	}
+	std::lock_guard<std::mutex> lock(mutex_);
+	// drop maps that are no longer used by anyone
+	maps_.erase(
+		std::remove_if(
+			maps_.begin(),
+			maps_.end(),
+			[](const std::weak_ptr<const OccupancyGrid>& map_weak_ptr) {
+				return map_weak_ptr.expired();
+			}
+		),
+		maps_.end()
+	);
+	for (const auto& map_weak_ptr: maps_) {
+		auto map_shared_ptr = map_weak_ptr.lock();
+		if (map_shared_ptr == map_ptr || (map_shared_ptr != nullptr && isEqual(*map_shared_ptr, *map_ptr))) {
+			return map_shared_ptr;
+		}
+	}
+	maps_.push_back(map_ptr);
+	return map_ptr;
+}
+
+std::shared_ptr<const FlowField> FlowFieldCache::get(
+	std::shared_ptr<const OccupancyGrid> map_ptr,
+	const Cell& goal
+) {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (auto& entry: entries_) {
+			if (entry.field_ptr->getMap() == map_ptr && entry.field_ptr->getGoal() == goal) {
+				entry.last_used = ++usage_counter_;
+				return entry.field_ptr;
+			}
+		}
+	}
+
+	// computation may take a while on large maps, other agents must not wait for it;
+	// if multiple agents request the same field at once, each computes it but only the first one is stored
+	auto field_ptr = std::make_shared<const FlowField>(map_ptr, goal);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	computations_++;
+	for (auto& entry: entries_) {
+		if (entry.field_ptr->getMap() == map_ptr && entry.field_ptr->getGoal() == goal) {
+			entry.last_used = ++usage_counter_;
+			return entry.field_ptr;
+		}
+	}
+	if (entries_.size() >= capacity_) {
+		auto lru_it = std::min_element(
+			entries_.begin(),
+			entries_.end(),
+			[](const Entry& a, const Entry& b) {
+				return a.last_used < b.last_used;
+			}
+		);
+		entries_.erase(lru_it);
+	}
+	entries_.push_back({field_ptr, ++usage_counter_});
+	return field_ptr;
+}
+
+size_t FlowFieldCache::getSize() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return entries_.size();
+}
+
+size_t FlowFieldCache::getComputationsNum() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return computations_;
+}
+
+std::shared_ptr<FlowFieldCache> FlowFieldCache::getSharedCache() {
+	static std::shared_ptr<FlowFieldCache> cache_ptr(std::make_shared<FlowFieldCache>());
+	return cache_ptr;
+}
+
+bool FlowFieldCache::isEqual(const OccupancyGrid& a, const OccupancyGrid& b) {
+	return a.getWidth() == b.getWidth()
+		&& a.getHeight() == b.getHeight()
+		&& a.getResolution() == b.getResolution()
+		&& a.getOriginX() == b.getOriginX()
+		&& a.getOriginY() == b.getOriginY()
+		&& a.getData() == b.getData();
+}
+
+} // namespace hubero
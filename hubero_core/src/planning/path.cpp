@@ -0,0 +1,116 @@
+#include <hubero_core/planning/path.h>
+
+#include <cmath>
+#include <utility>
+
+namespace hubero {
+
+// static
+Path Path::fromCells(const OccupancyGrid& map, const std::vector<OccupancyGrid::Cell>& cells, double yaw_default) {
+	Path path;
+	path.reserve(cells.size());
+	for (size_t i = 0; i < cells.size(); i++) {
+		double yaw = yaw_default;
+		if (i + 1 < cells.size()) {
+			yaw = std::atan2(cells[i + 1].y - cells[i].y, cells[i + 1].x - cells[i].x);
+		} else if (i > 0) {
+			yaw = std::atan2(cells[i].y - cells[i - 1].y, cells[i].x - cells[i - 1].x);
+		}
+		double x = 0.0;
+		double y = 0.0;
+		map.cellToWorld(cells[i], x, y);
+		path.push_back(x, y, yaw);
+	}
+	return path;
+}
+
+void Path::transform(const Pose3& transform) {
+	double yaw = transform.Rot().Yaw();
+	double c = std::cos(yaw);
+	double s = std::sin(yaw);
+	double tx = transform.Pos().X();
+	double ty = transform.Pos().Y();
+	for (size_t i = 0; i < size(); i++) {
+		double x = x_[i];
+		double y = y_[i];
+		x_[i] = c * x - s * y + tx;
+		y_[i] = s * x + c * y + ty;
+		yaw_[i] = std::atan2(std::sin(yaw_[i] + yaw), std::cos(yaw_[i] + yaw));
+	}
+}
+
+void Path::decimate(size_t step) {
+	if (step <= 1 || size() <= 2) {
+		return;
+	}
+	std::vector<bool> keep(size(), false);
+	for (size_t i = 0; i < size(); i += step) {
+		keep[i] = true;
+	}
+	keep.back() = true;
+	filter(keep);
+}
+
+void Path::simplify(double tolerance) {
+	if (size() <= 2) {
+		return;
+	}
+	std::vector<bool> keep(size(), false);
+	keep.front() = true;
+	keep.back() = true;
+
+	// iterative version of the recursive algorithm - stack of index ranges
+	std::vector<std::pair<size_t, size_t>> ranges {{0, size() - 1}};
+	while (!ranges.empty()) {
+		auto range = ranges.back();
+		ranges.pop_back();
+		double dx = x_[range.second] - x_[range.first];
+		double dy = y_[range.second] - y_[range.first];
+		double length = std::hypot(dx, dy);
+
+		double dist_max = 0.0;
+		size_t index_max = range.first;
+		for (size_t i = range.first + 1; i < range.second; i++) {
+			double px = x_[i] - x_[range.first];
+			double py = y_[i] - y_[range.first];
+			// distance to the segment's line or to its start if the segment degenerates to a point
+			double dist = length > 0.0 ? std::abs(dx * py - dy * px) / length : std::hypot(px, py);
+			if (dist > dist_max) {
+				dist_max = dist;
+				index_max = i;
+			}
+		}
+		if (dist_max > tolerance) {
+			keep[index_max] = true;
+			ranges.push_back({range.first, index_max});
+			ranges.push_back({index_max, range.second});
+		}
+	}
+	filter(keep);
+}
+
+double Path::getLength() const {
+	double length = 0.0;
+	for (size_t i = 1; i < size(); i++) {
+		length += std::hypot(x_[i] - x_[i - 1], y_[i] - y_[i - 1]);
+	}
+	return length;
+}
+
+void Path::filter(const std::vector<bool>& keep) {
+	size_t j = 0;
+	for (size_t i = 0; i < size(); i++) {
+		if (!keep[i]) {
+			continue;
+		}
+		x_[j] = x_[i];
+		y_[j] = y_[i];
+		yaw_[j] = yaw_[i];
+		j++;
+	}
+	x_.resize(j);
+	y_.resize(j);
+	yaw_.resize(j);
+}
+
+} // namespace hubero
@@ -0,0 +1,396 @@
+#include <hubero_core/planning/region_graph_planner.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <utility>
+
+namespace hubero {
+
+const int RegionGraphPlanner::REGION_SIZE_DEFAULT = 32;
+const int RegionGraphPlanner::CORRIDOR_MARGIN_DEFAULT = 1;
+
+static const double REGION_INF = std::numeric_limits<double>::infinity();
+static const double REGION_SQRT2 = 1.4142135623730951;
+static const size_t REGION_NO_PARENT = std::numeric_limits<size_t>::max();
+
+/// 8-connected neighbourhood
+static const int REGION_NEIGHBOURS_NUM = 8;
+static const int REGION_NEIGHBOURS_DX[REGION_NEIGHBOURS_NUM] = {1, -1, 0, 0, 1, 1, -1, -1};
+static const int REGION_NEIGHBOURS_DY[REGION_NEIGHBOURS_NUM] = {0, 0, 1, -1, 1, -1, 1, -1};
+
+/// Entry of the priority queues (min-heap); entries become stale when a better cost is found
+typedef std::pair<double, size_t> RegionQueueEntry;
+typedef std::priority_queue<
+	RegionQueueEntry,
+	std::vector<RegionQueueEntry>,
+	std::greater<RegionQueueEntry>
+> RegionQueue;
+
+RegionGraphPlanner::Query::Query():
+	stamp_current(0),
+	path_cost(REGION_INF),
+	expansions(0)
+{}
+
+RegionGraphPlanner::RegionGraphPlanner():
+	region_size_(REGION_SIZE_DEFAULT),
+	corridor_margin_(CORRIDOR_MARGIN_DEFAULT)
+{}
+
+void RegionGraphPlanner::initialize(std::shared_ptr<const OccupancyGrid> map_ptr, int region_size) {
+	map_ptr_ = map_ptr;
+	region_size_ = std::max(region_size, 1);
+	regions_.clear();
+	portals_.clear();
+	query_ = Query();
+	if (map_ptr_ == nullptr) {
+		return;
+	}
+
+	cell_region_.assign(map_ptr_->getData().size(), -1);
+
+	for (int block_y = 0; block_y * region_size_ < map_ptr_->getHeight(); block_y++) {
+		for (int block_x = 0; block_x * region_size_ < map_ptr_->getWidth(); block_x++) {
+			computeRegions(block_x, block_y);
+		}
+	}
+	computePortals();
+}
+
+bool RegionGraphPlanner::isInitialized() const {
+	return map_ptr_ != nullptr && map_ptr_->isValid();
+}
+
+void RegionGraphPlanner::setCorridorMargin(int regions) {
+	corridor_margin_ = std::max(regions, 0);
+}
+
+bool RegionGraphPlanner::plan(const Cell& start, const Cell& goal) {
+	return plan(start, goal, query_);
+}
+
+bool RegionGraphPlanner::plan(const Cell& start, const Cell& goal, Query& query) const {
+	query.path.clear();
+	query.path_cost = REGION_INF;
+	query.expansions = 0;
+	query.corridor.clear();
+	if (!isInitialized() || map_ptr_->isOccupied(start) || map_ptr_->isOccupied(goal)) {
+		return false;
+	}
+
+	// buffers of the query are allocated once (per map)
+	size_t cells = map_ptr_->getData().size();
+	if (query.cell_stamp.size() != cells || query.corridor_stamp.size() != regions_.size()) {
+		query.cell_stamp.assign(cells, 0);
+		query.cell_g.assign(cells, REGION_INF);
+		query.cell_parent.assign(cells, REGION_NO_PARENT);
+		query.corridor_stamp.assign(regions_.size(), 0);
+		query.stamp_current = 0;
+	}
+
+	// states of cells and regions from the previous queries become invalid
+	query.stamp_current++;
+	if (!searchCorridor(start, goal, query)) {
+		return false;
+	}
+	for (int i = 0; i < corridor_margin_; i++) {
+		widenCorridor(query);
+	}
+	return searchPath(start, goal, query);
+}
+
+std::vector<RegionGraphPlanner::Cell> RegionGraphPlanner::getPath() const {
+	return query_.path;
+}
+
+double RegionGraphPlanner::getPathCost() const {
+	return query_.path_cost;
+}
+
+size_t RegionGraphPlanner::getExpansionsNum() const {
+	return query_.expansions;
+}
+
+std::vector<int> RegionGraphPlanner::getCorridor() const {
+	return query_.corridor;
+}
+
+int RegionGraphPlanner::getRegion(const Cell& cell) const {
+	if (!isInitialized() || !map_ptr_->isInside(cell.x, cell.y)) {
+		return -1;
+	}
+	return cell_region_[map_ptr_->getIndex(cell.x, cell.y)];
+}
+
+size_t RegionGraphPlanner::getRegionsNum() const {
+	return regions_.size();
+}
+
+size_t RegionGraphPlanner::getPortalsNum() const {
+	return portals_.size();
+}
+
+void RegionGraphPlanner::computeRegions(int block_x, int block_y) {
+	int x_min = block_x * region_size_;
+	int y_min = block_y * region_size_;
+	int x_max = std::min(x_min + region_size_, map_ptr_->getWidth());
+	int y_max = std::min(y_min + region_size_, map_ptr_->getHeight());
+
+	std::deque<Cell> queue;
+	for (int y = y_min; y < y_max; y++) {
+		for (int x = x_min; x < x_max; x++) {
+			if (map_ptr_->isOccupied(x, y) || cell_region_[map_ptr_->getIndex(x, y)] >= 0) {
+				continue;
+			}
+			// flood fill of the new region; 4-connectivity is equivalent to 8-connectivity without corner cutting
+			int region = static_cast<int>(regions_.size());
+			regions_.push_back(Region());
+			cell_region_[map_ptr_->getIndex(x, y)] = region;
+			queue.push_back(Cell(x, y));
+			while (!queue.empty()) {
+				Cell cell = queue.front();
+				queue.pop_front();
+				for (int i = 0; i < 4; i++) {
+					Cell next(cell.x + REGION_NEIGHBOURS_DX[i], cell.y + REGION_NEIGHBOURS_DY[i]);
+					if (next.x < x_min || next.y < y_min || next.x >= x_max || next.y >= y_max) {
+						continue;
+					}
+					size_t index = map_ptr_->getIndex(next.x, next.y);
+					if (map_ptr_->isOccupied(next) || cell_region_[index] >= 0) {
+						continue;
+					}
+					cell_region_[index] = region;
+					queue.push_back(next);
+				}
+			}
+		}
+	}
+}
+
+void RegionGraphPlanner::computePortals() {
+	// regions may touch along the block borders only; collect all crossings per pair of regions
+	std::map<std::pair<int, int>, std::vector<std::pair<Cell, Cell>>> crossings;
+	auto check = [&](const Cell& cell, const Cell& next) {
+		int region = getRegion(cell);
+		int region_next = getRegion(next);
+		if (region < 0 || region_next < 0 || region == region_next) {
+			return;
+		}
+		if (region < region_next) {
+			crossings[{region, region_next}].push_back({cell, next});
+		} else {
+			crossings[{region_next, region}].push_back({next, cell});
+		}
+	};
+	for (int y = 0; y < map_ptr_->getHeight(); y++) {
+		for (int x = region_size_ - 1; x < map_ptr_->getWidth() - 1; x += region_size_) {
+			check(Cell(x, y), Cell(x + 1, y));
+		}
+	}
+	for (int y = region_size_ - 1; y < map_ptr_->getHeight() - 1; y += region_size_) {
+		for (int x = 0; x < map_ptr_->getWidth(); x++) {
+			check(Cell(x, y), Cell(x, y + 1));
+		}
+	}
+
+	for (const auto& pair_crossings: crossings) {
+		// crossing in the middle of the common border represents the pair well enough
+		const auto& crossing = pair_crossings.second.at(pair_crossings.second.size() / 2);
+		int portal = static_cast<int>(portals_.size());
+		portals_.push_back(
+			Portal {pair_crossings.first.first, pair_crossings.first.second, crossing.first, crossing.second}
+		);
+		regions_[pair_crossings.first.first].portals.push_back(portal);
+		regions_[pair_crossings.first.first].neighbours.push_back(pair_crossings.first.second);
+		regions_[pair_crossings.first.second].portals.push_back(portal);
+		regions_[pair_crossings.first.second].neighbours.push_back(pair_crossings.first.first);
+	}
+}
+
+bool RegionGraphPlanner::searchCorridor(const Cell& start, const Cell& goal, Query& query) const {
+	int region_start = getRegion(start);
+	int region_goal = getRegion(goal);
+
+	auto include = [&](int region) {
+		if (query.corridor_stamp[region] != query.stamp_current) {
+			query.corridor_stamp[region] = query.stamp_current;
+			query.corridor.push_back(region);
+		}
+	};
+
+	if (region_start == region_goal) {
+		include(region_start);
+		return true;
+	}
+
+	/*
+	 * Node '2 * p + s' represents standing at the portal 'p' on its side 's' (0 - region_a, 1 - region_b),
+	 * the last node is the goal. Distances inside regions are approximated with straight lines.
+	 */
+	size_t node_goal = 2 * portals_.size();
+	std::vector<double> g(node_goal + 1, REGION_INF);
+	std::vector<size_t> parent(node_goal + 1, REGION_NO_PARENT);
+	RegionQueue queue;
+
+	auto getNodeCell = [&](size_t node) -> Cell {
+		const Portal& portal = portals_[node / 2];
+		return (node % 2 == 0) ? portal.cell_a : portal.cell_b;
+	};
+	auto getNodeRegion = [&](size_t node) -> int {
+		const Portal& portal = portals_[node / 2];
+		return (node % 2 == 0) ? portal.region_a : portal.region_b;
+	};
+	auto getNodeInRegion = [&](int portal_id, int region) -> size_t {
+		return 2 * static_cast<size_t>(portal_id) + (portals_[portal_id].region_a == region ? 0 : 1);
+	};
+	auto relax = [&](size_t node, double cost, size_t node_parent) {
+		if (cost >= g[node]) {
+			return;
+		}
+		g[node] = cost;
+		parent[node] = node_parent;
+		Cell cell = (node == node_goal) ? goal : getNodeCell(node);
+		queue.push({cost + computeDistance(cell, goal), node});
+	};
+
+	for (int portal_id: regions_[region_start].portals) {
+		size_t node = getNodeInRegion(portal_id, region_start);
+		relax(node, computeDistance(start, getNodeCell(node)), REGION_NO_PARENT);
+	}
+
+	while (!queue.empty()) {
+		auto top = queue.top();
+		queue.pop();
+		size_t node = top.second;
+		Cell cell = (node == node_goal) ? goal : getNodeCell(node);
+		if (top.first > g[node] + computeDistance(cell, goal)) {
+			// stale entry
+			continue;
+		}
+		if (node == node_goal) {
+			break;
+		}
+
+		// crossing the portal
+		size_t node_other = node ^ 1;
+		relax(node_other, g[node] + computeDistance(cell, getNodeCell(node_other)), node);
+
+		// moving inside the region
+		int region = getNodeRegion(node);
+		if (region == region_goal) {
+			relax(node_goal, g[node] + computeDistance(cell, goal), node);
+		}
+		for (int portal_id: regions_[region].portals) {
+			size_t node_next = getNodeInRegion(portal_id, region);
+			if (node_next != node) {
+				relax(node_next, g[node] + computeDistance(cell, getNodeCell(node_next)), node);
+			}
+		}
+	}
+
+	if (g[node_goal] == REGION_INF) {
+		return false;
+	}
+	include(region_start);
+	include(region_goal);
+	for (size_t node = parent[node_goal]; node != REGION_NO_PARENT; node = parent[node]) {
+		include(getNodeRegion(node));
+	}
+	return true;
+}
+
+void RegionGraphPlanner::widenCorridor(Query& query) const {
+	size_t corridor_size = query.corridor.size();
+	for (size_t i = 0; i < corridor_size; i++) {
+		for (int neighbour: regions_[query.corridor[i]].neighbours) {
+			if (query.corridor_stamp[neighbour] != query.stamp_current) {
+				query.corridor_stamp[neighbour] = query.stamp_current;
+				query.corridor.push_back(neighbour);
+			}
+		}
+	}
+}
+
+bool RegionGraphPlanner::searchPath(const Cell& start, const Cell& goal, Query& query) const {
+	auto getG = [&](size_t index) -> double {
+		return query.cell_stamp[index] == query.stamp_current ? query.cell_g[index] : REGION_INF;
+	};
+
+	RegionQueue queue;
+	size_t index_start = map_ptr_->getIndex(start.x, start.y);
+	size_t index_goal = map_ptr_->getIndex(goal.x, goal.y);
+	query.cell_stamp[index_start] = query.stamp_current;
+	query.cell_g[index_start] = 0.0;
+	query.cell_parent[index_start] = REGION_NO_PARENT;
+	queue.push({computeHeuristic(start, goal), index_start});
+
+	while (!queue.empty()) {
+		auto top = queue.top();
+		queue.pop();
+		size_t index = top.second;
+		Cell cell = map_ptr_->getCell(index);
+		if (top.first > getG(index) + computeHeuristic(cell, goal)) {
+			// stale entry
+			continue;
+		}
+		if (index == index_goal) {
+			break;
+		}
+		query.expansions++;
+
+		for (int i = 0; i < REGION_NEIGHBOURS_NUM; i++) {
+			int dx = REGION_NEIGHBOURS_DX[i];
+			int dy = REGION_NEIGHBOURS_DY[i];
+			Cell next(cell.x + dx, cell.y + dy);
+			if (!isInCorridor(next, query)) {
+				continue;
+			}
+			bool diagonal = dx != 0 && dy != 0;
+			// no corner cutting
+			if (diagonal && (map_ptr_->isOccupied(cell.x + dx, cell.y) || map_ptr_->isOccupied(cell.x, cell.y + dy))) {
+				continue;
+			}
+			double cost = getG(index) + map_ptr_->getResolution() * (diagonal ? REGION_SQRT2 : 1.0);
+			size_t index_next = map_ptr_->getIndex(next.x, next.y);
+			if (cost >= getG(index_next)) {
+				continue;
+			}
+			query.cell_stamp[index_next] = query.stamp_current;
+			query.cell_g[index_next] = cost;
+			query.cell_parent[index_next] = index;
+			queue.push({cost + computeHeuristic(next, goal), index_next});
+		}
+	}
+
+	if (getG(index_goal) == REGION_INF) {
+		return false;
+	}
+	query.path_cost = getG(index_goal);
+	for (size_t index = index_goal; index != REGION_NO_PARENT; index = query.cell_parent[index]) {
+		query.path.push_back(map_ptr_->getCell(index));
+	}
+	std::reverse(query.path.begin(), query.path.end());
+	return true;
+}
+
+double RegionGraphPlanner::computeHeuristic(const Cell& from, const Cell& to) const {
+	double dx = std::abs(from.x - to.x);
+	double dy = std::abs(from.y - to.y);
+	return map_ptr_->getResolution() * (std::max(dx, dy) + (REGION_SQRT2 - 1.0) * std::min(dx, dy));
+}
+
+double RegionGraphPlanner::computeDistance(const Cell& from, const Cell& to) const {
+	return map_ptr_->getResolution() * std::hypot(from.x - to.x, from.y - to.y);
+}
+
+bool RegionGraphPlanner::isInCorridor(const Cell& cell, const Query& query) const {
+	int region = getRegion(cell);
+	return region >= 0 && query.corridor_stamp[region] == query.stamp_current;
+}
+
+} // namespace hubero
@@ -0,0 +1,316 @@
+#include <hubero_core/planning/roadmap.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace hubero {
+
+const size_t Roadmap::NODES_NUM_DEFAULT = 500;
+const int Roadmap::CONNECTION_RADIUS_DEFAULT = 30;
+
+static const double ROADMAP_INF = std::numeric_limits<double>::infinity();
+/// Max number of draws per node when sampling free cells
+static const size_t ROADMAP_SAMPLING_ATTEMPTS = 20;
+
+Roadmap::Roadmap():
+	connection_radius_(CONNECTION_RADIUS_DEFAULT),
+	edges_num_(0),
+	buckets_width_(0),
+	buckets_height_(0),
+	path_cost_(ROADMAP_INF)
+{}
+
+void Roadmap::initialize(
+	std::shared_ptr<const OccupancyGrid> map_ptr,
+	size_t nodes_num,
+	int connection_radius,
+	unsigned int seed
+) {
+	map_ptr_ = map_ptr;
+	connection_radius_ = std::max(connection_radius, 1);
+	nodes_.clear();
+	edges_.clear();
+	edges_num_ = 0;
+	node_component_.clear();
+	components_.clear();
+	buckets_.clear();
+	path_.clear();
+	path_cost_ = ROADMAP_INF;
+	if (map_ptr_ == nullptr) {
+		return;
+	}
+	const auto& map = *map_ptr_;
+
+	buckets_width_ = (map.getWidth() + connection_radius_ - 1) / connection_radius_;
+	buckets_height_ = (map.getHeight() + connection_radius_ - 1) / connection_radius_;
+	buckets_.resize(static_cast<size_t>(buckets_width_) * buckets_height_);
+
+	// sample free cells (duplicates are not an issue, they are connected with a zero-length edge)
+	std::mt19937 gen(seed);
+	std::uniform_int_distribution<int> distr_x(0, std::max(map.getWidth() - 1, 0));
+	std::uniform_int_distribution<int> distr_y(0, std::max(map.getHeight() - 1, 0));
+	for (size_t i = 0; i < nodes_num * ROADMAP_SAMPLING_ATTEMPTS && nodes_.size() < nodes_num; i++) {
+		Cell cell(distr_x(gen), distr_y(gen));
+		if (map.isOccupied(cell)) {
+			continue;
+		}
+		buckets_[(cell.y / connection_radius_) * buckets_width_ + cell.x / connection_radius_].push_back(
+			static_cast<int>(nodes_.size())
+		);
+		nodes_.push_back(cell);
+	}
+
+	// connect nodes that see each other
+	edges_.resize(nodes_.size());
+	for (int i = 0; i < static_cast<int>(nodes_.size()); i++) {
+		for (int j: findNodesNearby(nodes_[i])) {
+			if (j <= i || !isVisible(nodes_[i], nodes_[j])) {
+				continue;
+			}
+			double cost = computeDistance(nodes_[i], nodes_[j]);
+			edges_[i].push_back({j, cost});
+			edges_[j].push_back({i, cost});
+			edges_num_++;
+		}
+	}
+
+	// label connected components
+	node_component_.assign(nodes_.size(), -1);
+	for (int i = 0; i < static_cast<int>(nodes_.size()); i++) {
+		if (node_component_[i] >= 0) {
+			continue;
+		}
+		int component = static_cast<int>(components_.size());
+		components_.push_back(std::vector<int>());
+		std::deque<int> queue {i};
+		node_component_[i] = component;
+		while (!queue.empty()) {
+			int node = queue.front();
+			queue.pop_front();
+			components_.back().push_back(node);
+			for (const auto& edge: edges_[node]) {
+				if (node_component_[edge.node] < 0) {
+					node_component_[edge.node] = component;
+					queue.push_back(edge.node);
+				}
+			}
+		}
+	}
+}
+
+bool Roadmap::isInitialized() const {
+	return map_ptr_ != nullptr;
+}
+
+int Roadmap::findNode(const Cell& cell) const {
+	if (!isInitialized() || map_ptr_->isOccupied(cell)) {
+		return -1;
+	}
+	int node_closest = -1;
+	double dist_closest = ROADMAP_INF;
+	for (int id: findNodesNearby(cell)) {
+		double dist = computeDistance(cell, nodes_[id]);
+		if (dist < dist_closest && isVisible(cell, nodes_[id])) {
+			dist_closest = dist;
+			node_closest = id;
+		}
+	}
+	return node_closest;
+}
+
+bool Roadmap::sampleReachable(const Cell& start, std::mt19937& gen, Cell& goal) const {
+	int node_start = findNode(start);
+	if (node_start < 0) {
+		return false;
+	}
+	const auto& component = components_[node_component_[node_start]];
+	std::uniform_int_distribution<size_t> distr(0, component.size() - 1);
+	goal = nodes_[component[distr(gen)]];
+	return true;
+}
+
+bool Roadmap::plan(const Cell& start, const Cell& goal) {
+	return plan(start, goal, path_, path_cost_);
+}
+
+bool Roadmap::plan(const Cell& start, const Cell& goal, std::vector<Cell>& path, double& cost) const {
+	path.clear();
+	cost = ROADMAP_INF;
+	if (!isInitialized() || map_ptr_->isOccupied(start) || map_ptr_->isOccupied(goal)) {
+		return false;
+	}
+
+	// shortcut for nearby cells
+	if (computeDistance(start, goal) <= connection_radius_ * map_ptr_->getResolution() && isVisible(start, goal)) {
+		path = {start, goal};
+		cost = computeDistance(start, goal);
+		return true;
+	}
+
+	// start and goal are temporarily linked with visible nodes; goal is represented by an extra node ID
+	const int node_goal = static_cast<int>(nodes_.size());
+	std::vector<Edge> links_start;
+	for (int id: findNodesNearby(start)) {
+		if (isVisible(start, nodes_[id])) {
+			links_start.push_back({id, computeDistance(start, nodes_[id])});
+		}
+	}
+	std::vector<double> cost_to_goal(nodes_.size(), ROADMAP_INF);
+	bool goal_linked = false;
+	for (int id: findNodesNearby(goal)) {
+		if (isVisible(nodes_[id], goal)) {
+			cost_to_goal[id] = computeDistance(nodes_[id], goal);
+			goal_linked = true;
+		}
+	}
+	if (links_start.empty() || !goal_linked) {
+		return false;
+	}
+
+	// A* on the graph; -1 parent stands for the start
+	std::vector<double> g(nodes_.size() + 1, ROADMAP_INF);
+	std::vector<int> parent(nodes_.size() + 1, -1);
+	typedef std::pair<double, int> Entry;
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+	auto push = [&](int node, double g_node, int node_parent) {
+		if (g_node >= g[node]) {
+			return;
+		}
+		g[node] = g_node;
+		parent[node] = node_parent;
+		double h = node == node_goal ? 0.0 : computeDistance(nodes_[node], goal);
+		queue.push({g_node + h, node});
+	};
+	for (const auto& link: links_start) {
+		push(link.node, link.cost, -1);
+	}
+	while (!queue.empty()) {
+		auto top = queue.top();
+		queue.pop();
+		int node = top.second;
+		if (node == node_goal) {
+			break;
+		}
+		double h = computeDistance(nodes_[node], goal);
+		if (top.first > g[node] + h) {
+			// stale entry
+			continue;
+		}
+		for (const auto& edge: edges_[node]) {
+			push(edge.node, g[node] + edge.cost, node);
+		}
+		if (cost_to_goal[node] < ROADMAP_INF) {
+			push(node_goal, g[node] + cost_to_goal[node], node);
+		}
+	}
+	if (g[node_goal] == ROADMAP_INF) {
+		return false;
+	}
+
+	path.push_back(goal);
+	for (int node = parent[node_goal]; node >= 0; node = parent[node]) {
+		path.push_back(nodes_[node]);
+	}
+	path.push_back(start);
+	std::reverse(path.begin(), path.end());
+	cost = g[node_goal];
+	return true;
+}
+
+std::vector<Roadmap::Cell> Roadmap::getPath() const {
+	return path_;
+}
+
+double Roadmap::getPathCost() const {
+	return path_cost_;
+}
+
+bool Roadmap::isVisible(const Cell& from, const Cell& to) const {
+	if (!isInitialized()) {
+		return false;
+	}
+	const auto& map = *map_ptr_;
+	// Bresenham's line; diagonal steps require both side cells to be free
+	int dx = std::abs(to.x - from.x);
+	int dy = -std::abs(to.y - from.y);
+	int sx = from.x < to.x ? 1 : -1;
+	int sy = from.y < to.y ? 1 : -1;
+	int err = dx + dy;
+	int x = from.x;
+	int y = from.y;
+	if (map.isOccupied(x, y)) {
+		return false;
+	}
+	while (x != to.x || y != to.y) {
+		int err2 = 2 * err;
+		bool step_x = err2 >= dy;
+		bool step_y = err2 <= dx;
+		if (step_x && step_y && (map.isOccupied(x + sx, y) || map.isOccupied(x, y + sy))) {
+			return false;
+		}
+		if (step_x) {
+			err += dy;
+			x += sx;
+		}
+		if (step_y) {
+			err += dx;
+			y += sy;
+		}
+		if (map.isOccupied(x, y)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+Roadmap::Cell Roadmap::getNode(int id) const {
+	return nodes_.at(id);
+}
+
+int Roadmap::getComponent(int id) const {
+	return node_component_.at(id);
+}
+
+size_t Roadmap::getNodesNum() const {
+	return nodes_.size();
+}
+
+size_t Roadmap::getEdgesNum() const {
+	return edges_num_;
+}
+
+size_t Roadmap::getComponentsNum() const {
+	return components_.size();
+}
+
+std::vector<int> Roadmap::findNodesNearby(const Cell& cell) const {
+	std::vector<int> nodes;
+	if (!isInitialized()) {
+		return nodes;
+	}
+	int bucket_x = cell.x / connection_radius_;
+	int bucket_y = cell.y / connection_radius_;
+	for (int by = std::max(bucket_y - 1, 0); by <= std::min(bucket_y + 1, buckets_height_ - 1); by++) {
+		for (int bx = std::max(bucket_x - 1, 0); bx <= std::min(bucket_x + 1, buckets_width_ - 1); bx++) {
+			for (int id: buckets_[by * buckets_width_ + bx]) {
+				int ddx = nodes_[id].x - cell.x;
+				int ddy = nodes_[id].y - cell.y;
+				if (ddx * ddx + ddy * ddy <= connection_radius_ * connection_radius_) {
+					nodes.push_back(id);
+				}
+			}
+		}
+	}
+	return nodes;
+}
+
+double Roadmap::computeDistance(const Cell& from, const Cell& to) const {
+	return std::hypot(to.x - from.x, to.y - from.y) * map_ptr_->getResolution();
+}
+
+} // namespace hubero
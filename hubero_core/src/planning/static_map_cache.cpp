@@ -0,0 +1,123 @@
+#include <hubero_core/planning/static_map_cache.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace hubero {
+
+StaticMapCache::Parameters::Parameters():
+	inflation_radius(0.3),
+	region_graph(true),
+	region_size(3.2),
+	roadmap(true),
+	roadmap_nodes(Roadmap::NODES_NUM_DEFAULT),
+	roadmap_connection_radius(3.0),
+	roadmap_seed(0)
+{}
+
+bool StaticMapCache::Parameters::operator==(const Parameters& other) const {
+	return inflation_radius == other.inflation_radius
+		&& region_graph == other.region_graph
+		&& region_size == other.region_size
+		&& roadmap == other.roadmap
+		&& roadmap_nodes == other.roadmap_nodes
+		&& roadmap_connection_radius == other.roadmap_connection_radius
+		&& roadmap_seed == other.roadmap_seed;
+}
+
+StaticMapCache::StaticMapCache(): builds_(0) {}
+
+StaticMapCache::Products StaticMapCache::get(const OccupancyGrid& map, const Parameters& params) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	Products products;
+	// drop structures that are no longer used by anyone
+	entries_.erase(
+		std::remove_if(
+			entries_.begin(),
+			entries_.end(),
+			[&products](const Entry& entry) {
+				return !StaticMapCache::lock(entry, products);
+			}
+		),
+		entries_.end()
+	);
+	for (const auto& entry: entries_) {
+		if (entry.params == params && isEqual(*entry.map_src_ptr, map) && StaticMapCache::lock(entry, products)) {
+			return products;
+		}
+	}
+
+	products = build(map, params);
+	builds_++;
+	entries_.push_back(
+		{
+			std::make_shared<const OccupancyGrid>(map),
+			params,
+			products.map_ptr,
+			products.region_planner_ptr,
+			products.roadmap_ptr
+		}
+	);
+	return products;
+}
+
+size_t StaticMapCache::getSize() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return entries_.size();
+}
+
+size_t StaticMapCache::getBuildsNum() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return builds_;
+}
+
+std::shared_ptr<StaticMapCache> StaticMapCache::getSharedCache() {
+	static std::shared_ptr<StaticMapCache> cache_ptr(std::make_shared<StaticMapCache>());
+	return cache_ptr;
+}
+
+bool StaticMapCache::lock(const Entry& entry, Products& products) {
+	products.map_ptr = entry.map_ptr.lock();
+	products.region_planner_ptr = entry.region_planner_ptr.lock();
+	products.roadmap_ptr = entry.roadmap_ptr.lock();
+	return products.map_ptr != nullptr
+		&& (!entry.params.region_graph || products.region_planner_ptr != nullptr)
+		&& (!entry.params.roadmap || products.roadmap_ptr != nullptr);
+}
+
+StaticMapCache::Products StaticMapCache::build(const OccupancyGrid& map, const Parameters& params) {
+	Products products;
+	products.map_ptr = std::make_shared<const OccupancyGrid>(map.inflate(params.inflation_radius));
+
+	if (params.region_graph) {
+		auto region_planner_ptr = std::make_shared<RegionGraphPlanner>();
+		region_planner_ptr->initialize(
+			products.map_ptr,
+			static_cast<int>(std::ceil(params.region_size / products.map_ptr->getResolution()))
+		);
+		products.region_planner_ptr = region_planner_ptr;
+	}
+
+	if (params.roadmap) {
+		auto roadmap_ptr = std::make_shared<Roadmap>();
+		roadmap_ptr->initialize(
+			products.map_ptr,
+			std::max(params.roadmap_nodes, static_cast<size_t>(1)),
+			static_cast<int>(std::ceil(params.roadmap_connection_radius / products.map_ptr->getResolution())),
+			params.roadmap_seed
+		);
+		products.roadmap_ptr = roadmap_ptr;
+	}
+	return products;
+}
+
+bool StaticMapCache::isEqual(const OccupancyGrid& a, const OccupancyGrid& b) {
+	return a.getWidth() == b.getWidth()
+		&& a.getHeight() == b.getHeight()
+		&& a.getResolution() == b.getResolution()
+		&& a.getOriginX() == b.getOriginX()
+		&& a.getOriginY() == b.getOriginY()
+		&& a.getData() == b.getData();
+}
+
+} // namespace hubero
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <hubero_interfaces/utils/actor_registry.h>
+
+using namespace hubero;
+
+static ActorRegistry::State createState(double x) {
+	ActorRegistry::State state;
+	state.pose = Pose3(x, 0.0, 0.0, 0.0, 0.0, 0.0);
+	state.vel_lin = Vector3(x, 0.0, 0.0);
+	return state;
+}
+
+TEST(HuberoActorRegistry, registration) {
+	ActorRegistry registry;
+	EXPECT_EQ(registry.add("john"), 0);
+	EXPECT_EQ(registry.add("jack"), 1);
+	// repeated registration returns the same ID
+	EXPECT_EQ(registry.add("john"), 0);
+	ASSERT_EQ(registry.size(), 2);
+
+	size_t id = 10;
+	ASSERT_TRUE(registry.findId("jack", id));
+	EXPECT_EQ(id, 1);
+	EXPECT_EQ(registry.getName(id), "jack");
+	EXPECT_FALSE(registry.findId("jim", id));
+	EXPECT_FALSE(registry.isPublished(0));
+}
+
+TEST(HuberoActorRegistry, doubleBuffering) {
+	ActorRegistry registry;
+	size_t john = registry.add("john");
+	size_t jack = registry.add("jack");
+
+	ASSERT_TRUE(registry.publish(1));
+	registry.write(john, createState(1.0));
+	// not visible until the next tick, regardless of the update order
+	EXPECT_FALSE(registry.isPublished(john));
+	EXPECT_DOUBLE_EQ(registry.read(john).pose.Pos().X(), 0.0);
+	registry.write(jack, createState(2.0));
+	// publication is performed once per tick
+	EXPECT_FALSE(registry.publish(1));
+	EXPECT_FALSE(registry.isPublished(jack));
+
+	ASSERT_TRUE(registry.publish(2));
+	ASSERT_TRUE(registry.isPublished(john));
+	ASSERT_TRUE(registry.isPublished(jack));
+	EXPECT_DOUBLE_EQ(registry.read(john).pose.Pos().X(), 1.0);
+	EXPECT_DOUBLE_EQ(registry.read(jack).pose.Pos().X(), 2.0);
+
+	// only john updates, so jack keeps the latest state
+	registry.write(john, createState(3.0));
+	EXPECT_DOUBLE_EQ(registry.read(john).pose.Pos().X(), 1.0);
+	ASSERT_TRUE(registry.publish(3));
+	EXPECT_DOUBLE_EQ(registry.read(john).pose.Pos().X(), 3.0);
+	EXPECT_DOUBLE_EQ(registry.read(jack).pose.Pos().X(), 2.0);
+
+	auto model = registry.getModel(john, "world");
+	EXPECT_EQ(model.getName(), "john");
+	EXPECT_EQ(model.getFrameId(), "world");
+	EXPECT_DOUBLE_EQ(model.getPose().Pos().X(), 3.0);
+	EXPECT_DOUBLE_EQ(model.getVelocityLinear().X(), 3.0);
+	EXPECT_DOUBLE_EQ(model.getVelocityAngular().X(), 0.0);
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
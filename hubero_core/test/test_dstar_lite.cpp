@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <hubero_core/planning/dstar_lite.h>
+
+#include <cmath>
+#include <limits>
+#include <queue>
+
+using namespace hubero;
+
+typedef OccupancyGrid::Cell Cell;
+
+/// Reference solution - Dijkstra with the same connectivity rules as the planner
+static double computeCostDijkstra(const OccupancyGrid& map, const Cell& start, const Cell& goal) {
+	const double inf = std::numeric_limits<double>::infinity();
+	std::vector<double> dist(map.getData().size(), inf);
+	typedef std::pair<double, size_t> Entry;
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+	dist[map.getIndex(start.x, start.y)] = 0.0;
+	queue.push({0.0, map.getIndex(start.x, start.y)});
+	while (!queue.empty()) {
+		auto top = queue.top();
+		queue.pop();
+		if (top.first > dist[top.second]) {
+			continue;
+		}
+		Cell c = map.getCell(top.second);
+		for (int dx = -1; dx <= 1; dx++) {
+			for (int dy = -1; dy <= 1; dy++) {
+				Cell n(c.x + dx, c.y + dy);
+				if ((dx == 0 && dy == 0) || map.isOccupied(n)) {
+					continue;
+				}
+				if (dx != 0 && dy != 0 && (map.isOccupied(c.x + dx, c.y) || map.isOccupied(c.x, c.y + dy))) {
+					continue;
+				}
+				double cost = top.first + map.getResolution() * ((dx != 0 && dy != 0) ? std::sqrt(2.0) : 1.0);
+				size_t index = map.getIndex(n.x, n.y);
+				if (cost < dist[index]) {
+					dist[index] = cost;
+					queue.push({cost, index});
+				}
+			}
+		}
+	}
+	return dist[map.getIndex(goal.x, goal.y)];
+}
+
+/// Map with a wall that has a single gap
+static std::shared_ptr<OccupancyGrid> createMap() {
+	auto map_ptr = std::make_shared<OccupancyGrid>(60, 40, 0.1);
+	for (int y = 0; y < 40; y++) {
+		if (y < 30 || y > 33) {
+			map_ptr->setOccupied(30, y, true);
+		}
+	}
+	return map_ptr;
+}
+
+TEST(HuberoDStarLite, initialPlan) {
+	auto map_ptr = createMap();
+	DStarLite planner;
+	ASSERT_FALSE(planner.isInitialized());
+	ASSERT_FALSE(planner.plan(Cell(5, 5), Cell(50, 5)));
+
+	planner.initialize(map_ptr);
+	ASSERT_TRUE(planner.isInitialized());
+	ASSERT_TRUE(planner.plan(Cell(5, 5), Cell(50, 5)));
+	EXPECT_NEAR(planner.getPathCost(), computeCostDijkstra(*map_ptr, Cell(5, 5), Cell(50, 5)), 1e-04);
+
+	auto path = planner.getPath();
+	ASSERT_FALSE(path.empty());
+	EXPECT_EQ(path.front(), Cell(5, 5));
+	EXPECT_EQ(path.back(), Cell(50, 5));
+	for (size_t i = 1; i < path.size(); i++) {
+		EXPECT_FALSE(map_ptr->isOccupied(path[i]));
+		EXPECT_LE(std::abs(path[i].x - path[i - 1].x), 1);
+		EXPECT_LE(std::abs(path[i].y - path[i - 1].y), 1);
+	}
+
+	// target inside obstacle
+	ASSERT_FALSE(planner.plan(Cell(5, 5), Cell(30, 5)));
+}
+
+TEST(HuberoDStarLite, movingTarget) {
+	auto map_ptr = createMap();
+	DStarLite planner;
+	planner.initialize(map_ptr);
+	ASSERT_TRUE(planner.plan(Cell(5, 5), Cell(50, 5)));
+	size_t expansions_initial = planner.getExpansionsNum();
+
+	// target moves a little each step, agent stays close to the root
+	for (int i = 1; i <= 10; i++) {
+		Cell agent(5 + i / 5, 5);
+		Cell target(50, 5 + i);
+		ASSERT_TRUE(planner.plan(agent, target));
+		EXPECT_EQ(planner.getRoot(), Cell(5, 5));
+		EXPECT_NEAR(planner.getPathCost(), computeCostDijkstra(*map_ptr, Cell(5, 5), target), 1e-04);
+		// repairing is much cheaper than planning from scratch
+		EXPECT_LT(planner.getExpansionsNum(), expansions_initial / 2);
+	}
+
+	// agent moved far away - search restarted at the agent
+	planner.setRerootDistance(3);
+	ASSERT_TRUE(planner.plan(Cell(15, 8), Cell(50, 15)));
+	EXPECT_EQ(planner.getRoot(), Cell(15, 8));
+	EXPECT_NEAR(planner.getPathCost(), computeCostDijkstra(*map_ptr, Cell(15, 8), Cell(50, 15)), 1e-04);
+}
+
+TEST(HuberoDStarLite, mapChanges) {
+	auto map_ptr = createMap();
+	DStarLite planner;
+	planner.initialize(map_ptr);
+	ASSERT_TRUE(planner.plan(Cell(5, 5), Cell(50, 5)));
+
+	// close the gap
+	for (int y = 30; y <= 33; y++) {
+		planner.updateCell(Cell(30, y), true);
+	}
+	ASSERT_FALSE(planner.plan(Cell(5, 5), Cell(50, 6)));
+	EXPECT_TRUE(planner.getPath().empty());
+	// map given in initialize is not modified
+	EXPECT_FALSE(map_ptr->isOccupied(30, 31));
+
+	// open a new gap
+	planner.updateCell(Cell(30, 10), false);
+	ASSERT_TRUE(planner.plan(Cell(5, 5), Cell(50, 6)));
+	auto map_ref = createMap();
+	for (int y = 30; y <= 33; y++) {
+		map_ref->setOccupied(30, y, true);
+	}
+	map_ref->setOccupied(30, 10, false);
+	EXPECT_NEAR(planner.getPathCost(), computeCostDijkstra(*map_ref, Cell(5, 5), Cell(50, 6)), 1e-04);
+}
+
+TEST(HuberoOccupancyGrid, conversionsAndInflation) {
+	OccupancyGrid map(20, 10, 0.5, -5.0, -2.5);
+	Cell cell;
+	ASSERT_TRUE(map.worldToCell(-4.9, -2.4, cell));
+	EXPECT_EQ(cell, Cell(0, 0));
+	ASSERT_FALSE(map.worldToCell(5.1, 0.0, cell));
+
+	double x = 0.0;
+	double y = 0.0;
+	map.cellToWorld(Cell(19, 9), x, y);
+	EXPECT_DOUBLE_EQ(x, 4.75);
+	EXPECT_DOUBLE_EQ(y, 2.25);
+
+	map.setOccupied(10, 5, true);
+	auto inflated = map.inflate(1.0);
+	EXPECT_TRUE(inflated.isOccupied(12, 5));
+	EXPECT_FALSE(inflated.isOccupied(13, 5));
+	EXPECT_FALSE(map.isOccupied(12, 5));
+
+	ASSERT_TRUE(inflated.findNearestFree(Cell(10, 5), 5, cell));
+	EXPECT_EQ(std::abs(cell.x - 10) + std::abs(cell.y - 5), 3);
+	ASSERT_FALSE(inflated.findNearestFree(Cell(10, 5), 2, cell));
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <hubero_core/planning/dstar_lite.h>
+#include <hubero_core/planning/flow_field.h>
+#include <hubero_core/planning/flow_field_cache.h>
+
+#include <cmath>
+
+using namespace hubero;
+
+typedef OccupancyGrid::Cell Cell;
+
+/// Map with a wall that has a single gap and a closed room
+static std::shared_ptr<OccupancyGrid> createMap() {
+	auto map_ptr = std::make_shared<OccupancyGrid>(60, 40, 0.1);
+	for (int y = 0; y < 40; y++) {
+		if (y < 30 || y > 33) {
+			map_ptr->setOccupied(20, y, true);
+		}
+	}
+	for (int i = 40; i <= 50; i++) {
+		map_ptr->setOccupied(i, 5, true);
+		map_ptr->setOccupied(i, 15, true);
+		map_ptr->setOccupied(40, i - 35, true);
+		map_ptr->setOccupied(50, i - 35, true);
+	}
+	return map_ptr;
+}
+
+TEST(HuberoFlowField, cost) {
+	auto map_ptr = createMap();
+	Cell goal(55, 35);
+	FlowField field(map_ptr, goal);
+	ASSERT_TRUE(field.isValid());
+	EXPECT_DOUBLE_EQ(field.getCost(goal), 0.0);
+	EXPECT_EQ(field.getCost(Cell(20, 10)), FlowField::INF);
+	EXPECT_EQ(field.getCost(Cell(-1, 10)), FlowField::INF);
+	// inside the closed room
+	EXPECT_FALSE(field.isReachable(Cell(45, 10)));
+
+	// costs must match the ones of the single-query planner
+	DStarLite planner;
+	planner.initialize(map_ptr);
+	for (const auto& start: {Cell(2, 2), Cell(10, 38), Cell(30, 5), Cell(58, 1)}) {
+		ASSERT_TRUE(planner.plan(start, goal));
+		EXPECT_NEAR(field.getCost(start), planner.getPathCost(), 1e-4);
+	}
+
+	FlowField field_invalid(map_ptr, Cell(20, 10));
+	EXPECT_FALSE(field_invalid.isValid());
+	EXPECT_FALSE(field_invalid.isReachable(Cell(2, 2)));
+}
+
+TEST(HuberoFlowField, descent) {
+	auto map_ptr = createMap();
+	Cell goal(55, 35);
+	FlowField field(map_ptr, goal);
+
+	Cell cell(2, 2);
+	Cell next;
+	double length = 0.0;
+	size_t steps = 0;
+	while (field.getNextCell(cell, next)) {
+		ASSERT_FALSE(map_ptr->isOccupied(next));
+		ASSERT_LT(field.getCost(next), field.getCost(cell));
+		length += std::hypot(next.x - cell.x, next.y - cell.y) * map_ptr->getResolution();
+		cell = next;
+		ASSERT_LT(++steps, map_ptr->getData().size());
+	}
+	EXPECT_EQ(cell, goal);
+	// descent follows the shortest path
+	EXPECT_NEAR(length, field.getCost(Cell(2, 2)), 1e-4);
+
+	EXPECT_EQ(field.getWaypoint(goal, 5), goal);
+	Cell waypoint = field.getWaypoint(Cell(2, 2), 5);
+	EXPECT_LT(field.getCost(waypoint), field.getCost(Cell(2, 2)));
+	EXPECT_EQ(field.getWaypoint(Cell(45, 10), 5), Cell(45, 10));
+}
+
+TEST(HuberoFlowField, cache) {
+	FlowFieldCache cache(2);
+
+	// agents obtain their own copies of the same map
+	auto map_a_ptr = cache.share(createMap());
+	auto map_b_ptr = cache.share(createMap());
+	ASSERT_EQ(map_a_ptr, map_b_ptr);
+	auto map_other_ptr = createMap();
+	map_other_ptr->setOccupied(1, 1, true);
+	EXPECT_NE(cache.share(map_other_ptr), map_a_ptr);
+
+	auto field_a_ptr = cache.get(map_a_ptr, Cell(55, 35));
+	auto field_b_ptr = cache.get(map_b_ptr, Cell(55, 35));
+	EXPECT_EQ(field_a_ptr, field_b_ptr);
+	EXPECT_EQ(cache.getComputationsNum(), 1);
+	EXPECT_EQ(cache.getSize(), 1);
+
+	cache.get(map_a_ptr, Cell(2, 2));
+	EXPECT_EQ(cache.getComputationsNum(), 2);
+	// first field is the least recently used one unless requested again
+	cache.get(map_a_ptr, Cell(55, 35));
+	cache.get(map_a_ptr, Cell(10, 38));
+	EXPECT_EQ(cache.getSize(), 2);
+	EXPECT_EQ(cache.get(map_a_ptr, Cell(55, 35)), field_a_ptr);
+	EXPECT_EQ(cache.getComputationsNum(), 3);
+	cache.get(map_a_ptr, Cell(2, 2));
+	EXPECT_EQ(cache.getComputationsNum(), 4);
+
+	EXPECT_EQ(FlowFieldCache::getSharedCache(), FlowFieldCache::getSharedCache());
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <hubero_core/navigation/goal_prefetcher.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace hubero;
+
+/// Waits until the prefetcher has @ref size goals ready
+static bool waitForGoals(const GoalPrefetcher& prefetcher, size_t size) {
+	for (int i = 0; i < 500; i++) {
+		if (prefetcher.getSize() >= size) {
+			return true;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	}
+	return false;
+}
+
+TEST(HuberoGoalPrefetcher, prefetch) {
+	// goals are located 1 meter ahead of the start
+	GoalPrefetcher prefetcher(
+		[](const Pose3& start) {
+			return std::make_tuple(true, Pose3(start.Pos().X() + 1.0, start.Pos().Y(), 0.0, 0.0, 0.0, 0.0));
+		},
+		3,
+		2
+	);
+	Pose3 goal;
+	// nothing is sampled until the start is known
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	EXPECT_FALSE(prefetcher.pop(goal));
+	EXPECT_EQ(prefetcher.getSamplesNum(), 0);
+
+	prefetcher.setStart(Pose3(2.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+	ASSERT_TRUE(waitForGoals(prefetcher, 3));
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	EXPECT_EQ(prefetcher.getSize(), 3);
+
+	ASSERT_TRUE(prefetcher.pop(goal));
+	EXPECT_DOUBLE_EQ(goal.Pos().X(), 3.0);
+	// popped goal is replaced
+	ASSERT_TRUE(waitForGoals(prefetcher, 3));
+
+	// goals sampled from the previous start are discarded
+	prefetcher.setStart(goal);
+	ASSERT_TRUE(waitForGoals(prefetcher, 1));
+	ASSERT_TRUE(prefetcher.pop(goal));
+	EXPECT_DOUBLE_EQ(goal.Pos().X(), 4.0);
+}
+
+TEST(HuberoGoalPrefetcher, samplerFailure) {
+	std::atomic<bool> reachable(false);
+	GoalPrefetcher prefetcher(
+		[&reachable](const Pose3& start) {
+			return std::make_tuple(bool(reachable), start);
+		},
+		2
+	);
+	prefetcher.setStart(Pose3());
+	std::this_thread::sleep_for(std::chrono::milliseconds(5 * GoalPrefetcher::RETRY_PERIOD / 2));
+	Pose3 goal;
+	EXPECT_FALSE(prefetcher.pop(goal));
+	// worker backs off after failures
+	EXPECT_LE(prefetcher.getSamplesNum(), 4);
+
+	reachable = true;
+	prefetcher.setStart(Pose3());
+	EXPECT_TRUE(waitForGoals(prefetcher, 2));
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <hubero_core/navigation/goal_update_policy.h>
+
+using namespace hubero;
+
+/// Runs the policy along the target trajectory given by @ref pose_fun, returns the number of updates
+template <typename T>
+static int simulate(GoalUpdatePolicy& policy, T pose_fun, double duration, double dt = 0.01) {
+	int updates = 0;
+	for (double t = 0.0; t < duration; t += dt) {
+		Pose3 pose = pose_fun(t);
+		if (policy.isUpdateRequired(pose, Time(t))) {
+			policy.markUpdated(pose, Time(t));
+			updates++;
+		}
+	}
+	return updates;
+}
+
+TEST(HuberoGoalUpdatePolicy, stationaryTarget) {
+	GoalUpdatePolicy policy;
+	auto params = policy.getParameters();
+	// first call always requests an update, then only the max period applies
+	int updates = simulate(policy, [](double) { return Pose3(1.0, 2.0, 0.0, 0.0, 0.0, 0.3); }, 21.0);
+	EXPECT_EQ(updates, 1 + static_cast<int>(20.0 / params.period_max));
+
+	// reset forces an update, even though the target did not move
+	policy.reset();
+	EXPECT_TRUE(policy.isUpdateRequired(Pose3(1.0, 2.0, 0.0, 0.0, 0.0, 0.3), Time(20.0)));
+}
+
+TEST(HuberoGoalUpdatePolicy, movingTarget) {
+	GoalUpdatePolicy::Parameters params;
+	params.distance_threshold = 0.5;
+	params.prediction_threshold = 100.0;
+	params.period_min = 0.0;
+	params.period_max = 100.0;
+	GoalUpdatePolicy policy(params);
+	// 1 m/s: the target exceeds distance threshold twice per second
+	int updates = simulate(policy, [](double t) { return Pose3(t, 0.0, 0.0, 0.0, 0.0, 0.0); }, 10.0);
+	EXPECT_NEAR(updates, 20, 1);
+	EXPECT_NEAR(policy.getTargetVelocity().X(), 1.0, 1e-03);
+
+	// fast target is limited by the min period
+	params.period_min = 1.0;
+	policy = GoalUpdatePolicy(params);
+	updates = simulate(policy, [](double t) { return Pose3(3.0 * t, 0.0, 0.0, 0.0, 0.0, 0.0); }, 10.0);
+	EXPECT_NEAR(updates, 10, 1);
+}
+
+TEST(HuberoGoalUpdatePolicy, headingAndPrediction) {
+	GoalUpdatePolicy::Parameters params;
+	params.distance_threshold = 100.0;
+	params.period_min = 0.0;
+	params.period_max = 100.0;
+	GoalUpdatePolicy policy(params);
+
+	// turning in place
+	Pose3 pose(0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+	ASSERT_TRUE(policy.isUpdateRequired(pose, Time(0.0)));
+	policy.markUpdated(pose, Time(0.0));
+	EXPECT_FALSE(policy.isUpdateRequired(Pose3(0.0, 0.0, 0.0, 0.0, 0.0, 0.5 * params.heading_threshold), Time(0.1)));
+	EXPECT_TRUE(policy.isUpdateRequired(Pose3(0.0, 0.0, 0.0, 0.0, 0.0, 1.1 * params.heading_threshold), Time(0.2)));
+
+	// target starts moving: predicted position diverges before the displacement gets significant
+	policy = GoalUpdatePolicy(params);
+	int updates = simulate(policy, [](double t) { return Pose3(t < 1.0 ? 0.0 : t - 1.0, 0.0, 0.0, 0.0, 0.0, 0.0); }, 2.0);
+	EXPECT_GE(updates, 2);
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <hubero_interfaces/model_control_base.h>
+
+#include <vector>
+
+using namespace hubero;
+
+/// Records channels passed to @ref apply
+class ModelControlRecorder: public ModelControlBase {
+public:
+	void initialize(uint8_t channels) {
+		ModelControlBase::initialize("world", channels);
+	}
+
+	std::vector<uint8_t> applied;
+
+protected:
+	virtual void apply(const ModelState& state, uint8_t channels) override {
+		applied.push_back(channels);
+	}
+};
+
+TEST(HuberoModelControlBase, handlers) {
+	ModelControlBase control;
+	// not initialized
+	control.update(Pose3(), Vector3(), Vector3(), Vector3(), Vector3());
+
+	int pose_calls = 0;
+	Vector3 vel_ang;
+	Vector3 vel_lin;
+	control.initialize(
+		"world",
+		[&](Pose3) { pose_calls++; },
+		[&](Vector3 v) { vel_ang = v; },
+		[&](Vector3 v) { vel_lin = v; },
+		nullptr,
+		nullptr
+	);
+	EXPECT_EQ(control.getEffectiveChannels(), MODEL_STATE_ALL);
+
+	control.update(Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0), Vector3(0.0, 0.0, 0.5), Vector3(1.0, 0.0, 0.0), Vector3(), Vector3());
+	EXPECT_EQ(pose_calls, 1);
+	EXPECT_DOUBLE_EQ(vel_ang.Z(), 0.5);
+	EXPECT_DOUBLE_EQ(vel_lin.X(), 1.0);
+
+	// unchanged state is not written again
+	control.update(Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0), Vector3(0.0, 0.0, 0.5), Vector3(1.0, 0.0, 0.0), Vector3(), Vector3());
+	EXPECT_EQ(pose_calls, 1);
+}
+
+TEST(HuberoModelControlBase, changedChannels) {
+	ModelControlRecorder control;
+	control.initialize(MODEL_STATE_POSE | MODEL_STATE_VEL_LIN);
+
+	// first update writes all effective channels
+	control.update(Pose3(), Vector3(), Vector3(), Vector3(), Vector3());
+	ASSERT_EQ(control.applied.size(), 1);
+	EXPECT_EQ(control.applied.back(), MODEL_STATE_POSE | MODEL_STATE_VEL_LIN);
+
+	// ineffective channels changed only
+	control.update(Pose3(), Vector3(0.0, 0.0, 1.0), Vector3(), Vector3(1.0, 0.0, 0.0), Vector3(0.0, 1.0, 0.0));
+	EXPECT_EQ(control.applied.size(), 1);
+
+	control.update(Pose3(), Vector3(), Vector3(0.3, 0.0, 0.0), Vector3(), Vector3());
+	ASSERT_EQ(control.applied.size(), 2);
+	EXPECT_EQ(control.applied.back(), MODEL_STATE_VEL_LIN);
+
+	// tiny rotation is not swallowed by comparison tolerance
+	control.update(Pose3(0.0, 0.0, 0.0, 0.0, 0.0, 1e-7), Vector3(), Vector3(0.3, 0.0, 0.0), Vector3(), Vector3());
+	ASSERT_EQ(control.applied.size(), 3);
+	EXPECT_EQ(control.applied.back(), MODEL_STATE_POSE);
+
+	ModelState prev;
+	ModelState curr;
+	EXPECT_EQ(ModelControlBase::computeChangedChannels(prev, curr), MODEL_STATE_NONE);
+	curr.acc_ang = Vector3(0.0, 0.0, 1.0);
+	curr.acc_lin = Vector3(1.0, 0.0, 0.0);
+	EXPECT_EQ(ModelControlBase::computeChangedChannels(prev, curr), MODEL_STATE_ACC_ANG | MODEL_STATE_ACC_LIN);
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <hubero_core/navigation/orca_solver.h>
+#include <hubero_core/navigation/navigation_crowd.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace hubero;
+
+/// Navigation that always commands the same velocity
+class NavigationConstVel: public NavigationBase {
+public:
+	NavigationConstVel(const Vector3& cmd_vel): cmd_vel_(cmd_vel) {}
+	virtual Vector3 getVelocityCmd() const override {
+		return cmd_vel_;
+	}
+protected:
+	Vector3 cmd_vel_;
+};
+
+static double distance(const Vector3& a, const Vector3& b) {
+	return std::hypot(a.X() - b.X(), a.Y() - b.Y());
+}
+
+TEST(HuberoOrcaSolver, freeSpace) {
+	OrcaSolver solver;
+	auto id = solver.addAgent();
+	// not updated yet
+	ASSERT_EQ(solver.getAgentsNum(), 0);
+	ASSERT_DOUBLE_EQ(solver.getVelocity(id).Length(), 0.0);
+
+	solver.updateAgent(id, Vector3(0.0, 0.0, 0.0), Vector3(), Vector3(0.5, 0.2, 0.0));
+	ASSERT_EQ(solver.getAgentsNum(), 1);
+	auto vel = solver.getVelocity(id);
+	EXPECT_NEAR(vel.X(), 0.5, 1e-06);
+	EXPECT_NEAR(vel.Y(), 0.2, 1e-06);
+}
+
+TEST(HuberoOrcaSolver, headOnEncounter) {
+	OrcaSolver solver;
+	auto params = solver.getParameters();
+	auto id_a = solver.addAgent();
+	auto id_b = solver.addAgent();
+
+	Vector3 pos_a(-3.0, 0.0, 0.0);
+	Vector3 pos_b(3.0, 0.01, 0.0);
+	Vector3 vel_a;
+	Vector3 vel_b;
+	const Vector3 goal_a(3.0, 0.0, 0.0);
+	const Vector3 goal_b(-3.0, 0.0, 0.0);
+	const double dt = 0.05;
+	const double speed = 0.8;
+
+	double dist_min = std::numeric_limits<double>::max();
+	for (int i = 0; i < 300; i++) {
+		auto pref_a = goal_a - pos_a;
+		auto pref_b = goal_b - pos_b;
+		pref_a.Z(0.0);
+		pref_b.Z(0.0);
+		pref_a = pref_a.Length() > speed ? pref_a.Normalize() * speed : pref_a;
+		pref_b = pref_b.Length() > speed ? pref_b.Normalize() * speed : pref_b;
+		solver.updateAgent(id_a, pos_a, vel_a, pref_a);
+		solver.updateAgent(id_b, pos_b, vel_b, pref_b);
+		vel_a = solver.getVelocity(id_a);
+		vel_b = solver.getVelocity(id_b);
+		pos_a += vel_a * dt;
+		pos_b += vel_b * dt;
+		dist_min = std::min(dist_min, distance(pos_a, pos_b));
+	}
+	// footprints never overlapped (small tolerance for discrete integration)
+	EXPECT_GT(dist_min, 2.0 * params.radius - 0.02);
+	// both reached their goals
+	EXPECT_LT(distance(pos_a, goal_a), 0.1);
+	EXPECT_LT(distance(pos_b, goal_b), 0.1);
+}
+
+TEST(HuberoOrcaSolver, agentRemoval) {
+	OrcaSolver solver;
+	auto id_a = solver.addAgent();
+	auto id_b = solver.addAgent();
+	solver.updateAgent(id_a, Vector3(0.0, 0.0, 0.0), Vector3(), Vector3(1.0, 0.0, 0.0));
+	// idle agent blocking the way
+	solver.updateAgent(id_b, Vector3(0.7, 0.0, 0.0), Vector3(), Vector3());
+	auto vel = solver.getVelocity(id_a);
+	EXPECT_LT(vel.X(), 1.0);
+
+	solver.removeAgent(id_b);
+	ASSERT_EQ(solver.getAgentsNum(), 1);
+	// removal does not trigger a new solve by itself
+	solver.updateAgent(id_a, Vector3(0.0, 0.0, 0.0), Vector3(), Vector3(1.0, 0.0, 0.0));
+	vel = solver.getVelocity(id_a);
+	EXPECT_NEAR(vel.X(), 1.0, 1e-06);
+
+	// slot is reused
+	ASSERT_EQ(solver.addAgent(), id_b);
+}
+
+TEST(HuberoNavigationCrowd, velocityCommand) {
+	auto solver_ptr = std::make_shared<OrcaSolver>();
+	auto nav_a_ptr = std::make_shared<NavigationConstVel>(Vector3(1.0, 0.0, 0.3));
+	auto nav_b_ptr = std::make_shared<NavigationConstVel>(Vector3(-1.0, 0.0, 0.0));
+	NavigationCrowd crowd_a(nav_a_ptr, solver_ptr);
+	NavigationCrowd crowd_b(nav_b_ptr, solver_ptr);
+
+	crowd_a.update(Pose3(0.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+	crowd_b.update(Pose3(1.5, 0.0, 0.0, 0.0, 0.0, 0.0));
+	auto cmd_a = crowd_a.getVelocityCmd();
+	auto cmd_b = crowd_b.getVelocityCmd();
+
+	// collision course, so commands must be adjusted
+	EXPECT_LT(cmd_a.X(), 1.0);
+	EXPECT_GT(cmd_b.X(), -1.0);
+	// rotational component passed through
+	EXPECT_DOUBLE_EQ(cmd_a.Z(), 0.3);
+	EXPECT_DOUBLE_EQ(cmd_b.Z(), 0.0);
+	// repeated requests within the same step do not change the command
+	EXPECT_EQ(crowd_a.getVelocityCmd(), cmd_a);
+
+	// the rest of the interface is forwarded
+	crowd_a.setGoal(Pose3(5.0, 0.0, 0.0, 0.0, 0.0, 0.0), "world");
+	EXPECT_EQ(nav_a_ptr->getFeedback(), TaskFeedbackType::TASK_FEEDBACK_PENDING);
+	EXPECT_EQ(crowd_a.getFeedback(), TaskFeedbackType::TASK_FEEDBACK_PENDING);
+	EXPECT_EQ(crowd_a.getGoalFrame(), "world");
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
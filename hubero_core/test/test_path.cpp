@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <hubero_core/planning/path.h>
+
+#include <cmath>
+
+using namespace hubero;
+
+typedef OccupancyGrid::Cell Cell;
+
+TEST(HuberoPath, fromCells) {
+	OccupancyGrid map(10, 10, 0.5, -1.0, 2.0);
+	auto path = Path::fromCells(map, {Cell(0, 0), Cell(1, 0), Cell(2, 1), Cell(2, 2)}, 1.0);
+	ASSERT_EQ(path.size(), 4);
+	EXPECT_DOUBLE_EQ(path.getX(0), -0.75);
+	EXPECT_DOUBLE_EQ(path.getY(0), 2.25);
+	EXPECT_DOUBLE_EQ(path.getYaw(0), 0.0);
+	EXPECT_DOUBLE_EQ(path.getYaw(1), IGN_PI / 4.0);
+	EXPECT_DOUBLE_EQ(path.getYaw(2), IGN_PI / 2.0);
+	EXPECT_DOUBLE_EQ(path.getYaw(3), IGN_PI / 2.0);
+	EXPECT_NEAR(path.getLength(), 0.5 + 0.5 * std::sqrt(2.0) + 0.5, 1e-9);
+
+	auto single = Path::fromCells(map, {Cell(3, 3)}, 1.0);
+	ASSERT_EQ(single.size(), 1);
+	EXPECT_DOUBLE_EQ(single.getYaw(0), 1.0);
+	EXPECT_TRUE(Path::fromCells(map, {}).empty());
+}
+
+TEST(HuberoPath, transform) {
+	Path path;
+	path.push_back(1.0, 2.0, 0.3);
+	path.push_back(-3.0, 0.5, 3.0);
+	Pose3 transform(0.5, -1.0, 0.0, 0.0, 0.0, 1.2);
+
+	Path transformed = path;
+	transformed.transform(transform);
+	for (size_t i = 0; i < path.size(); i++) {
+		Pose3 expected = path.getPose(i) + transform;
+		EXPECT_NEAR(transformed.getX(i), expected.Pos().X(), 1e-9);
+		EXPECT_NEAR(transformed.getY(i), expected.Pos().Y(), 1e-9);
+		EXPECT_NEAR(transformed.getYaw(i), expected.Rot().Yaw(), 1e-9);
+	}
+}
+
+TEST(HuberoPath, decimateSimplify) {
+	// L-shaped path with slight noise
+	Path path;
+	for (int i = 0; i <= 10; i++) {
+		path.push_back(0.1 * i, (i % 2) * 0.01, 0.0);
+	}
+	for (int i = 1; i <= 10; i++) {
+		path.push_back(1.0, 0.1 * i, IGN_PI / 2.0);
+	}
+	ASSERT_EQ(path.size(), 21);
+
+	Path decimated = path;
+	decimated.decimate(4);
+	// 0, 4, 8, 12, 16, 20
+	ASSERT_EQ(decimated.size(), 6);
+	EXPECT_DOUBLE_EQ(decimated.getY(5), 1.0);
+	decimated.decimate(7);
+	ASSERT_EQ(decimated.size(), 2);
+
+	Path simplified = path;
+	simplified.simplify(0.05);
+	ASSERT_EQ(simplified.size(), 3);
+	EXPECT_DOUBLE_EQ(simplified.getX(1), 1.0);
+	EXPECT_DOUBLE_EQ(simplified.getY(1), 0.0);
+	EXPECT_DOUBLE_EQ(simplified.getYaw(2), IGN_PI / 2.0);
+
+	// tolerance below the noise keeps the zigzag
+	Path detailed = path;
+	detailed.simplify(0.001);
+	EXPECT_GT(detailed.size(), 10);
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <hubero_core/planning/dstar_lite.h>
+#include <hubero_core/planning/region_graph_planner.h>
+
+#include <cmath>
+
+using namespace hubero;
+
+typedef OccupancyGrid::Cell Cell;
+
+/// Map with walls (each with a single gap) that force detours through the whole map
+static std::shared_ptr<OccupancyGrid> createMap() {
+	auto map_ptr = std::make_shared<OccupancyGrid>(200, 120, 0.1);
+	for (int y = 0; y < 120; y++) {
+		if (y < 100 || y > 105) {
+			map_ptr->setOccupied(70, y, true);
+		}
+		if (y < 10 || y > 14) {
+			map_ptr->setOccupied(130, y, true);
+		}
+	}
+	// isolated room
+	for (int i = 170; i <= 190; i++) {
+		map_ptr->setOccupied(i, 90, true);
+		map_ptr->setOccupied(i, 110, true);
+		map_ptr->setOccupied(170, i - 80, true);
+		map_ptr->setOccupied(190, i - 80, true);
+	}
+	return map_ptr;
+}
+
+/// Reference: optimal cost computed by the planner that explores the whole map if needed
+static double computeCostOptimal(std::shared_ptr<const OccupancyGrid> map_ptr, const Cell& start, const Cell& goal) {
+	DStarLite planner;
+	planner.initialize(map_ptr);
+	planner.plan(start, goal);
+	return planner.getPathCost();
+}
+
+TEST(HuberoRegionGraphPlanner, regionGraph) {
+	auto map_ptr = createMap();
+	RegionGraphPlanner planner;
+	ASSERT_FALSE(planner.isInitialized());
+	ASSERT_FALSE(planner.plan(Cell(5, 5), Cell(150, 5)));
+
+	planner.initialize(map_ptr, 20);
+	ASSERT_TRUE(planner.isInitialized());
+	// 10x6 blocks; walls split 5 blocks each into 2 regions (blocks with gaps are not split);
+	// the room splits 4 blocks into 2 regions each (inside and outside)
+	EXPECT_EQ(planner.getRegionsNum(), 60 + 5 + 5 + 4);
+	EXPECT_GT(planner.getPortalsNum(), planner.getRegionsNum());
+	EXPECT_EQ(planner.getRegion(Cell(70, 50)), -1);
+	EXPECT_NE(planner.getRegion(Cell(69, 50)), planner.getRegion(Cell(71, 50)));
+	EXPECT_EQ(planner.getRegion(Cell(69, 102)), planner.getRegion(Cell(71, 102)));
+}
+
+TEST(HuberoRegionGraphPlanner, plan) {
+	auto map_ptr = createMap();
+	RegionGraphPlanner planner;
+	planner.initialize(map_ptr, 20);
+
+	Cell start(5, 5);
+	Cell goal(150, 5);
+	ASSERT_TRUE(planner.plan(start, goal));
+	auto path = planner.getPath();
+	ASSERT_FALSE(path.empty());
+	EXPECT_EQ(path.front(), start);
+	EXPECT_EQ(path.back(), goal);
+	for (size_t i = 1; i < path.size(); i++) {
+		EXPECT_FALSE(map_ptr->isOccupied(path[i]));
+		EXPECT_LE(std::abs(path[i].x - path[i - 1].x), 1);
+		EXPECT_LE(std::abs(path[i].y - path[i - 1].y), 1);
+	}
+
+	// corridor restricts the search but the path stays close to the optimal one
+	double cost_optimal = computeCostOptimal(map_ptr, start, goal);
+	EXPECT_GE(planner.getPathCost(), cost_optimal - 1e-06);
+	EXPECT_LE(planner.getPathCost(), 1.1 * cost_optimal);
+	size_t expansions_corridor = planner.getExpansionsNum();
+
+	// corridor covering the whole map (except the isolated room) gives the optimal path
+	planner.setCorridorMargin(100);
+	ASSERT_TRUE(planner.plan(start, goal));
+	EXPECT_NEAR(planner.getPathCost(), cost_optimal, 1e-06);
+	EXPECT_EQ(planner.getCorridor().size(), planner.getRegionsNum() - 4);
+	EXPECT_LT(expansions_corridor, planner.getExpansionsNum());
+
+	// start and goal in the same region
+	planner.setCorridorMargin(0);
+	ASSERT_TRUE(planner.plan(Cell(1, 1), Cell(4, 3)));
+	EXPECT_EQ(planner.getCorridor().size(), 1);
+	EXPECT_NEAR(planner.getPathCost(), computeCostOptimal(map_ptr, Cell(1, 1), Cell(4, 3)), 1e-06);
+}
+
+TEST(HuberoRegionGraphPlanner, unreachable) {
+	auto map_ptr = createMap();
+	RegionGraphPlanner planner;
+	planner.initialize(map_ptr, 20);
+
+	// inside obstacle
+	EXPECT_FALSE(planner.plan(Cell(5, 5), Cell(70, 5)));
+	// isolated room
+	EXPECT_FALSE(planner.plan(Cell(5, 5), Cell(180, 100)));
+	EXPECT_TRUE(planner.getPath().empty());
+	// planning inside the room is fine
+	EXPECT_TRUE(planner.plan(Cell(175, 95), Cell(185, 105)));
+}
+
+TEST(HuberoRegionGraphPlanner, sharedPlanner) {
+	auto map_ptr = createMap();
+	auto planner_ptr = std::make_shared<RegionGraphPlanner>();
+	planner_ptr->initialize(map_ptr, 20);
+	std::shared_ptr<const RegionGraphPlanner> shared_ptr = planner_ptr;
+
+	// interleaved queries with separate states do not affect each other
+	RegionGraphPlanner::Query query1;
+	RegionGraphPlanner::Query query2;
+	ASSERT_TRUE(shared_ptr->plan(Cell(5, 5), Cell(150, 5), query1));
+	ASSERT_TRUE(shared_ptr->plan(Cell(175, 95), Cell(185, 105), query2));
+	EXPECT_EQ(query1.path.back(), Cell(150, 5));
+	EXPECT_EQ(query2.path.back(), Cell(185, 105));
+	EXPECT_NEAR(query1.path_cost, computeCostOptimal(map_ptr, Cell(5, 5), Cell(150, 5)), 1e-06);
+
+	ASSERT_FALSE(shared_ptr->plan(Cell(5, 5), Cell(180, 100), query2));
+	EXPECT_TRUE(query2.path.empty());
+	EXPECT_FALSE(query1.path.empty());
+	// query of the planner itself is untouched
+	EXPECT_TRUE(planner_ptr->getPath().empty());
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
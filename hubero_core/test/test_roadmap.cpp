@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <hubero_core/planning/dstar_lite.h>
+#include <hubero_core/planning/roadmap.h>
+
+#include <cmath>
+
+using namespace hubero;
+
+typedef OccupancyGrid::Cell Cell;
+
+/// Map with a wall that has a single gap and a closed room
+static std::shared_ptr<OccupancyGrid> createMap() {
+	auto map_ptr = std::make_shared<OccupancyGrid>(100, 60, 0.1);
+	for (int y = 0; y < 60; y++) {
+		if (y < 45 || y > 52) {
+			map_ptr->setOccupied(40, y, true);
+		}
+	}
+	for (int i = 70; i <= 90; i++) {
+		map_ptr->setOccupied(i, 10, true);
+		map_ptr->setOccupied(i, 30, true);
+		map_ptr->setOccupied(70, i - 60, true);
+		map_ptr->setOccupied(90, i - 60, true);
+	}
+	return map_ptr;
+}
+
+TEST(HuberoRoadmap, visibility) {
+	auto map_ptr = createMap();
+	Roadmap roadmap;
+	ASSERT_FALSE(roadmap.isInitialized());
+	ASSERT_FALSE(roadmap.isVisible(Cell(5, 5), Cell(6, 6)));
+
+	roadmap.initialize(map_ptr, 0);
+	ASSERT_TRUE(roadmap.isInitialized());
+	EXPECT_TRUE(roadmap.isVisible(Cell(5, 5), Cell(35, 20)));
+	EXPECT_TRUE(roadmap.isVisible(Cell(35, 20), Cell(5, 5)));
+	EXPECT_FALSE(roadmap.isVisible(Cell(35, 20), Cell(45, 20)));
+	EXPECT_TRUE(roadmap.isVisible(Cell(35, 48), Cell(45, 48)));
+	EXPECT_FALSE(roadmap.isVisible(Cell(40, 20), Cell(40, 20)));
+
+	// diagonal squeeze between two occupied cells
+	map_ptr->setOccupied(11, 10, true);
+	map_ptr->setOccupied(10, 11, true);
+	EXPECT_FALSE(roadmap.isVisible(Cell(10, 10), Cell(11, 11)));
+	EXPECT_FALSE(roadmap.isVisible(Cell(11, 11), Cell(10, 10)));
+}
+
+TEST(HuberoRoadmap, graph) {
+	auto map_ptr = createMap();
+	Roadmap roadmap;
+	roadmap.initialize(map_ptr, 300, 15, 7);
+	ASSERT_EQ(roadmap.getNodesNum(), 300);
+	EXPECT_GT(roadmap.getEdgesNum(), roadmap.getNodesNum());
+	// at least the room and the remaining free space
+	EXPECT_GE(roadmap.getComponentsNum(), 2);
+
+	for (size_t i = 0; i < roadmap.getNodesNum(); i++) {
+		EXPECT_FALSE(map_ptr->isOccupied(roadmap.getNode(i)));
+	}
+
+	// nodes inside the room are not connected with nodes outside of it
+	int node_room = roadmap.findNode(Cell(80, 20));
+	int node_outside = roadmap.findNode(Cell(20, 20));
+	ASSERT_GE(node_room, 0);
+	ASSERT_GE(node_outside, 0);
+	EXPECT_NE(roadmap.getComponent(node_room), roadmap.getComponent(node_outside));
+	EXPECT_EQ(roadmap.findNode(Cell(40, 20)), -1);
+
+	std::mt19937 gen(3);
+	Cell goal;
+	for (int i = 0; i < 20; i++) {
+		ASSERT_TRUE(roadmap.sampleReachable(Cell(80, 20), gen, goal));
+		EXPECT_EQ(roadmap.getComponent(roadmap.findNode(goal)), roadmap.getComponent(node_room));
+		EXPECT_TRUE(goal.x > 70 && goal.x < 90 && goal.y > 10 && goal.y < 30);
+	}
+}
+
+TEST(HuberoRoadmap, plan) {
+	auto map_ptr = createMap();
+	Roadmap roadmap;
+	roadmap.initialize(map_ptr, 400, 15, 7);
+
+	Cell start(5, 5);
+	Cell goal(95, 55);
+	ASSERT_TRUE(roadmap.plan(start, goal));
+	auto path = roadmap.getPath();
+	ASSERT_GE(path.size(), 3);
+	EXPECT_EQ(path.front(), start);
+	EXPECT_EQ(path.back(), goal);
+	double length = 0.0;
+	for (size_t i = 1; i < path.size(); i++) {
+		EXPECT_TRUE(roadmap.isVisible(path[i - 1], path[i]));
+		length += std::hypot(path[i].x - path[i - 1].x, path[i].y - path[i - 1].y) * map_ptr->getResolution();
+	}
+	EXPECT_NEAR(length, roadmap.getPathCost(), 1e-6);
+
+	// roadmap paths are not optimal, but they must not be much longer than the grid ones
+	DStarLite planner;
+	planner.initialize(map_ptr);
+	ASSERT_TRUE(planner.plan(start, goal));
+	EXPECT_GE(roadmap.getPathCost(), planner.getPathCost() * 0.95);
+	EXPECT_LE(roadmap.getPathCost(), planner.getPathCost() * 1.3);
+
+	// nearby cells are connected directly
+	ASSERT_TRUE(roadmap.plan(Cell(5, 5), Cell(10, 12)));
+	EXPECT_EQ(roadmap.getPath().size(), 2);
+
+	EXPECT_FALSE(roadmap.plan(start, Cell(80, 20)));
+	EXPECT_TRUE(roadmap.getPath().empty());
+	EXPECT_FALSE(roadmap.plan(start, Cell(40, 20)));
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <hubero_interfaces/utils/spatial_grid.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace hubero;
+
+TEST(HuberoSpatialGrid, updateAndRemove) {
+	SpatialGrid grid(1.0);
+	ASSERT_EQ(grid.size(), 0);
+
+	grid.update(0, 0.5, 0.5);
+	grid.update(3, -2.5, 4.0);
+	ASSERT_EQ(grid.size(), 2);
+	ASSERT_TRUE(grid.contains(0));
+	ASSERT_FALSE(grid.contains(1));
+	ASSERT_TRUE(grid.contains(3));
+
+	// move within the same cell and across cells
+	grid.update(0, 0.7, 0.2);
+	grid.update(3, 10.0, 10.0);
+	ASSERT_EQ(grid.size(), 2);
+	auto ids = grid.queryRadius(10.0, 10.0, 0.1);
+	ASSERT_EQ(ids.size(), 1);
+	EXPECT_EQ(ids.front(), 3);
+	EXPECT_TRUE(grid.queryRadius(-2.5, 4.0, 0.5).empty());
+
+	grid.remove(3);
+	grid.remove(3);
+	ASSERT_EQ(grid.size(), 1);
+	EXPECT_TRUE(grid.queryRadius(10.0, 10.0, 0.1).empty());
+	EXPECT_TRUE(grid.queryNearest(0.0, 0.0, 5).size() == 1);
+	// query far away from any occupied cell
+	auto nearest = grid.queryNearest(1000.0, -1000.0, 1);
+	ASSERT_EQ(nearest.size(), 1);
+	EXPECT_EQ(nearest.front().first, 0);
+}
+
+TEST(HuberoSpatialGrid, queriesMatchBruteForce) {
+	SpatialGrid grid(1.5);
+	std::mt19937 gen(7);
+	std::uniform_real_distribution<double> dist(-20.0, 20.0);
+	std::vector<std::pair<double, double>> points;
+	for (size_t i = 0; i < 300; i++) {
+		points.push_back({dist(gen), dist(gen)});
+		grid.update(i, points.back().first, points.back().second);
+	}
+
+	for (int q = 0; q < 50; q++) {
+		double x = dist(gen);
+		double y = dist(gen);
+		double radius = std::abs(dist(gen)) / 2.0;
+
+		std::vector<std::pair<double, size_t>> expected;
+		for (size_t i = 0; i < points.size(); i++) {
+			expected.push_back({std::hypot(points[i].first - x, points[i].second - y), i});
+		}
+		std::sort(expected.begin(), expected.end());
+
+		// radius
+		auto ids = grid.queryRadius(x, y, radius);
+		std::sort(ids.begin(), ids.end());
+		std::vector<size_t> ids_expected;
+		for (const auto& e: expected) {
+			if (e.first <= radius) {
+				ids_expected.push_back(e.second);
+			}
+		}
+		std::sort(ids_expected.begin(), ids_expected.end());
+		EXPECT_EQ(ids, ids_expected);
+
+		// k-nearest
+		const size_t k = 7;
+		auto nearest = grid.queryNearest(x, y, k);
+		ASSERT_EQ(nearest.size(), k);
+		for (size_t i = 0; i < k; i++) {
+			EXPECT_EQ(nearest[i].first, expected[i].second);
+			EXPECT_NEAR(nearest[i].second, expected[i].first, 1e-09);
+		}
+
+		// k-nearest limited by radius
+		nearest = grid.queryNearest(x, y, k, radius);
+		size_t within = std::count_if(
+			expected.begin(),
+			expected.end(),
+			[&](const std::pair<double, size_t>& e) { return e.first <= radius; }
+		);
+		EXPECT_EQ(nearest.size(), std::min(k, within));
+	}
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
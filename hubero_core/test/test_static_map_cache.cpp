@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <hubero_core/planning/static_map_cache.h>
+
+using namespace hubero;
+
+typedef OccupancyGrid::Cell Cell;
+
+/// Map with a wall that has a single gap
+static OccupancyGrid createMap() {
+	OccupancyGrid map(100, 60, 0.1);
+	for (int y = 0; y < 60; y++) {
+		if (y < 45 || y > 52) {
+			map.setOccupied(40, y, true);
+		}
+	}
+	return map;
+}
+
+TEST(HuberoStaticMapCache, share) {
+	StaticMapCache cache;
+	StaticMapCache::Parameters params;
+	params.roadmap_nodes = 100;
+
+	// agents obtain their own copies of the same map
+	auto products_a = cache.get(createMap(), params);
+	auto products_b = cache.get(createMap(), params);
+	ASSERT_NE(products_a.map_ptr, nullptr);
+	ASSERT_NE(products_a.region_planner_ptr, nullptr);
+	ASSERT_NE(products_a.roadmap_ptr, nullptr);
+	EXPECT_EQ(products_a.map_ptr, products_b.map_ptr);
+	EXPECT_EQ(products_a.region_planner_ptr, products_b.region_planner_ptr);
+	EXPECT_EQ(products_a.roadmap_ptr, products_b.roadmap_ptr);
+	EXPECT_EQ(cache.getBuildsNum(), 1);
+	// obstacles are inflated
+	EXPECT_TRUE(products_a.map_ptr->isOccupied(Cell(42, 10)));
+
+	// different content or parameters
+	auto map_other = createMap();
+	map_other.setOccupied(1, 1, true);
+	EXPECT_NE(cache.get(map_other, params).map_ptr, products_a.map_ptr);
+	params.roadmap = false;
+	auto products_no_roadmap = cache.get(createMap(), params);
+	EXPECT_NE(products_no_roadmap.map_ptr, products_a.map_ptr);
+	EXPECT_EQ(products_no_roadmap.roadmap_ptr, nullptr);
+	EXPECT_EQ(cache.getBuildsNum(), 3);
+	// structures of the other map were released right away
+	EXPECT_EQ(cache.getSize(), 2);
+
+	// structures are rebuilt once no one uses them
+	products_a = StaticMapCache::Products();
+	products_b = StaticMapCache::Products();
+	params.roadmap = true;
+	cache.get(createMap(), params);
+	EXPECT_EQ(cache.getBuildsNum(), 4);
+
+	EXPECT_EQ(StaticMapCache::getSharedCache(), StaticMapCache::getSharedCache());
+}
+
+TEST(HuberoStaticMapCache, seed) {
+	StaticMapCache::Parameters params;
+	params.roadmap_nodes = 100;
+
+	// separate caches with the same seed build identical roadmaps
+	StaticMapCache cache_a;
+	StaticMapCache cache_b;
+	auto roadmap_a_ptr = cache_a.get(createMap(), params).roadmap_ptr;
+	auto roadmap_b_ptr = cache_b.get(createMap(), params).roadmap_ptr;
+	ASSERT_NE(roadmap_a_ptr, roadmap_b_ptr);
+	EXPECT_EQ(roadmap_a_ptr->getNodesNum(), roadmap_b_ptr->getNodesNum());
+	EXPECT_EQ(roadmap_a_ptr->getEdgesNum(), roadmap_b_ptr->getEdgesNum());
+	for (size_t i = 0; i < roadmap_a_ptr->getNodesNum(); i++) {
+		EXPECT_EQ(roadmap_a_ptr->getNode(i), roadmap_b_ptr->getNode(i));
+	}
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -110,6 +110,77 @@ TEST(HuberoTaskRequestObjective, requestTeleop) {
 	ASSERT_EQ(task.getCommand().Z(), 0.5);
 }
 
+/// World where the followed object may be missing, counts name lookups
+class WorldGeometryLookups: public WorldGeometryBase {
+public:
+	WorldGeometryLookups(): object_exists(false), lookups(0) {}
+
+	virtual ModelHandle resolveModel(const std::string& name) const override {
+		lookups++;
+		return object_exists ? WorldGeometryBase::resolveModel(name) : ModelHandle();
+	}
+
+	bool object_exists;
+	mutable size_t lookups;
+};
+
+/// Exposes memory update that is otherwise triggered by the task execution
+class TaskFollowObjectMemory: public TaskFollowObject {
+public:
+	using TaskFollowObject::updateMemory;
+};
+
+TEST(HuberoTaskRequestObjective, followObjectLookups) {
+	auto world_ptr = std::make_shared<WorldGeometryLookups>();
+	world_ptr->initialize("world");
+	auto memory_ptr = std::make_shared<InternalMemory>();
+	TaskFollowObjectMemory task;
+	task.initialize(
+		std::make_shared<AnimationControlBase>(),
+		std::make_shared<NavigationBase>(),
+		world_ptr,
+		memory_ptr
+	);
+	ASSERT_TRUE(task.isInitialized());
+
+	memory_ptr->setGoal(Pose3(1.0, 2.0, 0.0, 0.0, 0.0, 0.0));
+	// name is resolved in the first update, not in the requesting thread
+	task.request("robot");
+	EXPECT_EQ(world_ptr->lookups, 0);
+	memory_ptr->setTime(Time(0.1));
+	task.updateMemory();
+	EXPECT_EQ(world_ptr->lookups, 1);
+
+	// missing object is looked up again no more than once per second, the goal is kept meanwhile
+	for (double t: {0.2, 0.6, 1.0}) {
+		memory_ptr->setTime(Time(t));
+		task.updateMemory();
+	}
+	EXPECT_EQ(world_ptr->lookups, 1);
+	EXPECT_EQ(memory_ptr->getPoseGoal(), Pose3(1.0, 2.0, 0.0, 0.0, 0.0, 0.0));
+	memory_ptr->setTime(Time(1.1));
+	task.updateMemory();
+	EXPECT_EQ(world_ptr->lookups, 2);
+	memory_ptr->setTime(Time(1.5));
+	task.updateMemory();
+	EXPECT_EQ(world_ptr->lookups, 2);
+
+	// object spawned, its pose is read with the handle afterwards
+	world_ptr->object_exists = true;
+	for (double t: {2.0, 2.1, 3.5}) {
+		memory_ptr->setTime(Time(t));
+		task.updateMemory();
+	}
+	EXPECT_EQ(world_ptr->lookups, 3);
+	EXPECT_EQ(memory_ptr->getPoseGoal(), Pose3());
+
+	// new request resolves the name again, even though the previous object is found
+	task.request("robot");
+	memory_ptr->setTime(Time(3.6));
+	task.updateMemory();
+	EXPECT_EQ(world_ptr->lookups, 4);
+}
+
 int main(int argc, char** argv) {
 	testing::InitGoogleTest(&argc, argv);
 	return RUN_ALL_TESTS();
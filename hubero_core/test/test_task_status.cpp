@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <hubero_core/tasks/task_move_to_goal.h>
 
+#include <chrono>
+#include <thread>
+
 using namespace hubero;
 
 /**
@@ -66,6 +69,66 @@ TEST(HuberoTaskStatus, terminate) {
 	ASSERT_EQ(task.getTaskFeedbackType(), TASK_FEEDBACK_TERMINATED);
 }
 
+TEST(HuberoTaskStatus, waitForFeedbackChange) {
+	TaskBase task(TASK_STAND);
+	task.request();
+	// nothing changes
+	ASSERT_EQ(task.waitForFeedbackChange(TASK_FEEDBACK_PENDING, std::chrono::milliseconds(5)), TASK_FEEDBACK_PENDING);
+
+	std::thread activator([&task]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		task.activate();
+	});
+	ASSERT_EQ(task.waitForFeedbackChange(TASK_FEEDBACK_PENDING, std::chrono::seconds(10)), TASK_FEEDBACK_ACTIVE);
+	activator.join();
+	// already different
+	ASSERT_EQ(task.waitForFeedbackChange(TASK_FEEDBACK_PENDING, std::chrono::seconds(10)), TASK_FEEDBACK_ACTIVE);
+}
+
+TEST(HuberoTaskStatus, waitForFeedbackEvent) {
+	TaskBase task(TASK_STAND);
+	auto event = task.getFeedbackEvent();
+	ASSERT_FALSE(task.waitForFeedbackEvent(event, std::chrono::milliseconds(5)));
+
+	// external notification
+	task.notifyFeedbackEvent();
+	ASSERT_TRUE(task.waitForFeedbackEvent(event, std::chrono::milliseconds(5)));
+
+	// feedback type change
+	event = task.getFeedbackEvent();
+	task.abort();
+	ASSERT_TRUE(task.waitForFeedbackEvent(event, std::chrono::milliseconds(5)));
+	ASSERT_EQ(task.getTaskFeedbackType(), TASK_FEEDBACK_ABORTED);
+}
+
+TEST(HuberoTaskStatus, feedbackNotifier) {
+	TaskBase task1(TASK_STAND);
+	TaskBase task2(TASK_MOVE_AROUND);
+	auto notifier = std::make_shared<TaskEventNotifier>();
+	task1.addFeedbackNotifier(notifier);
+	task2.addFeedbackNotifier(notifier);
+
+	auto event = notifier->getEvent();
+	ASSERT_FALSE(notifier->wait(event, std::chrono::milliseconds(5)));
+
+	// events of any task wake up the shared waiter
+	std::thread activator([&task2]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		task2.activate();
+	});
+	ASSERT_TRUE(notifier->wait(event, std::chrono::seconds(10)));
+	activator.join();
+
+	event = notifier->getEvent();
+	task1.notifyFeedbackEvent();
+	ASSERT_TRUE(notifier->wait(event, std::chrono::milliseconds(5)));
+
+	// notifier is held weakly, the task keeps working once it is destroyed
+	notifier.reset();
+	task1.abort();
+	ASSERT_EQ(task1.getTaskFeedbackType(), TASK_FEEDBACK_ABORTED);
+}
+
 int main(int argc, char** argv) {
 	testing::InitGoogleTest(&argc, argv);
 	return RUN_ALL_TESTS();
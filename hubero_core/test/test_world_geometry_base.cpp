@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <hubero_interfaces/world_geometry_base.h>
+
+#include <cmath>
+
+using namespace hubero;
+
+// 10 x 10 m map with a wall along x = 5.0 m, from y = 0 to y = 6 m
+static std::shared_ptr<const OccupancyGrid> createMap() {
+	auto map_ptr = std::make_shared<OccupancyGrid>(100, 100, 0.1);
+	for (int y = 0; y < 60; y++) {
+		map_ptr->setOccupied(50, y, true);
+	}
+	return map_ptr;
+}
+
+TEST(HuberoWorldGeometryBase, noMap) {
+	WorldGeometryBase world;
+	world.initialize("world");
+	auto ranges = world.castRays({Pose3(1.0, 1.0, 0.0, 0.0, 0.0, 0.0)}, 3.0);
+	ASSERT_EQ(ranges.size(), 1);
+	EXPECT_DOUBLE_EQ(ranges.at(0), 3.0);
+	EXPECT_FALSE(world.checkOccupancy({Vector3(1.0, 1.0, 0.0)}).at(0));
+	EXPECT_TRUE(world.checkLineOfSight({{Vector3(1.0, 1.0, 0.0), Vector3(9.0, 1.0, 0.0)}}).at(0));
+}
+
+TEST(HuberoWorldGeometryBase, castRays) {
+	WorldGeometryBase world;
+	world.initialize("world");
+	world.setOccupancyGrid(createMap());
+
+	auto ranges = world.castRays(
+		{
+			// towards the wall
+			Pose3(1.05, 2.0, 0.0, 0.0, 0.0, 0.0),
+			// diagonally towards the wall
+			Pose3(3.05, 2.0, 0.0, 0.0, 0.0, IGN_PI / 4.0),
+			// away from the wall, hit map borders
+			Pose3(1.05, 2.0, 0.0, 0.0, 0.0, -IGN_PI / 2.0),
+			Pose3(1.05, 2.0, 0.0, 0.0, 0.0, IGN_PI),
+			// above the wall
+			Pose3(1.05, 7.0, 0.0, 0.0, 0.0, 0.0),
+			// starts in the wall
+			Pose3(5.05, 2.0, 0.0, 0.0, 0.0, 0.0)
+		},
+		5.0
+	);
+	ASSERT_EQ(ranges.size(), 6);
+	EXPECT_NEAR(ranges.at(0), 3.95, 1e-9);
+	EXPECT_NEAR(ranges.at(1), 1.95 * std::sqrt(2.0), 1e-9);
+	EXPECT_NEAR(ranges.at(2), 2.0, 1e-9);
+	EXPECT_NEAR(ranges.at(3), 1.05, 1e-9);
+	EXPECT_DOUBLE_EQ(ranges.at(4), 5.0);
+	EXPECT_DOUBLE_EQ(ranges.at(5), 0.0);
+
+	// wall is not in range
+	ranges = world.castRays({Pose3(1.05, 2.0, 0.0, 0.0, 0.0, 0.0)}, 2.0);
+	EXPECT_DOUBLE_EQ(ranges.at(0), 2.0);
+}
+
+TEST(HuberoWorldGeometryBase, occupancyLineOfSight) {
+	WorldGeometryBase world;
+	world.initialize("world");
+	world.setOccupancyGrid(createMap());
+
+	auto occupied = world.checkOccupancy({
+		Vector3(5.05, 3.0, 0.0),
+		Vector3(4.95, 3.0, 0.0),
+		Vector3(5.05, 6.05, 0.0),
+		// outside of the map
+		Vector3(-1.0, 3.0, 0.0)
+	});
+	ASSERT_EQ(occupied.size(), 4);
+	EXPECT_TRUE(occupied.at(0));
+	EXPECT_FALSE(occupied.at(1));
+	EXPECT_FALSE(occupied.at(2));
+	EXPECT_TRUE(occupied.at(3));
+
+	auto visible = world.checkLineOfSight({
+		{Vector3(2.0, 2.0, 0.0), Vector3(8.0, 2.0, 0.0)},
+		{Vector3(2.0, 7.0, 0.0), Vector3(8.0, 7.0, 0.0)},
+		// passes above the end of the wall
+		{Vector3(2.0, 5.0, 0.0), Vector3(8.0, 8.0, 0.0)},
+		// crosses the wall
+		{Vector3(2.0, 8.0, 0.0), Vector3(8.0, 3.0, 0.0)},
+		{Vector3(2.0, 2.0, 0.0), Vector3(4.0, 4.0, 0.0)}
+	});
+	ASSERT_EQ(visible.size(), 5);
+	EXPECT_FALSE(visible.at(0));
+	EXPECT_TRUE(visible.at(1));
+	EXPECT_TRUE(visible.at(2));
+	EXPECT_FALSE(visible.at(3));
+	EXPECT_TRUE(visible.at(4));
+	// symmetric
+	EXPECT_FALSE(world.checkLineOfSight({{Vector3(8.0, 2.0, 0.0), Vector3(2.0, 2.0, 0.0)}}).at(0));
+}
+
+TEST(HuberoWorldGeometryBase, modelHandles) {
+	WorldGeometryBase world;
+	EXPECT_TRUE(world.resolveModel("table").isNull());
+
+	world.initialize("world");
+	auto handle = world.resolveModel("table");
+	ASSERT_FALSE(handle.isNull());
+	EXPECT_TRUE(world.isModelValid(handle));
+	EXPECT_EQ(world.resolveModel("table").id, handle.id);
+	EXPECT_NE(world.resolveModel("chair").id, handle.id);
+	EXPECT_EQ(world.getModel(handle).getName(), "table");
+	EXPECT_EQ(world.getModel(handle).getFrameId(), "world");
+
+	Pose3 pose(1.0, 2.0, 3.0, 0.0, 0.0, 0.0);
+	EXPECT_TRUE(world.getModelPose(handle, pose));
+	EXPECT_EQ(pose, Pose3());
+
+	ModelHandle null_handle;
+	EXPECT_FALSE(world.isModelValid(null_handle));
+	EXPECT_FALSE(world.getModelPose(null_handle, pose));
+	EXPECT_TRUE(world.getModel(null_handle).getName().empty());
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -19,6 +19,7 @@
 #include <hubero_gazebo/animation_control_gazebo.h>
 #include <hubero_gazebo/localisation_gazebo.h>
 #include <hubero_gazebo/model_control_gazebo.h>
+#include <hubero_gazebo/skeleton_bounds_gazebo.h>
 #include <hubero_gazebo/time_gazebo.h>
 #include <hubero_gazebo/world_geometry_gazebo.h>
 
@@ -28,6 +29,7 @@
 #include <hubero_ros/status_ros.h>
 
 #include <hubero_core/actor.h>
+#include <hubero_core/navigation/navigation_crowd.h>
 
 namespace gazebo {
 
@@ -36,6 +38,9 @@ public:
 	/// @brief Defines multiplier that adjusts animation speed (>1 is related to speed-up)
 	const double ANIMATION_FACTOR_DEFAULT = 5.0;
 
+	/// @brief Defines max time (real time, in seconds) to wait for the navigation to get ready
+	const double STARTUP_TIMEOUT_DEFAULT = 8.0;
+
 	/// @brief Constructor
 	ActorPlugin();
 
@@ -50,6 +55,9 @@ public:
 protected:
 	bool controller_enabled_;
 
+	/// @brief Controller is enabled once the navigation is ready or after this time (real time, in seconds)
+	double startup_timeout_;
+
 	/// @brief Instance of the main agent of the HuBeRo framework - the Actor agent
 	hubero::Actor hubero_actor_;
 
@@ -72,11 +80,35 @@ protected:
 	std::shared_ptr<hubero::StatusRos> ros_status_ptr_;
 	/// @}
 
+	/**
+	 * @brief Navigation provided to the Actor; decorates @ref ros_nav_ptr_ if crowd avoidance is enabled
+	 */
+	std::shared_ptr<hubero::NavigationBase> nav_ptr_;
+
 private:
+	/**
+	 * @brief Enables crowd-level collision avoidance if requested in SDF with the @ref crowd_avoidance element
+	 *
+	 * @details Parameters are applied to the solver shared by all actors, so they should be the same
+	 * for all actors in the world
+	 */
+	void loadCrowdAvoidance(sdf::ElementPtr sdf);
+
+	/**
+	 * @brief Updates navigation (so it publishes odometry and TF) until it gets ready or @ref startup_timeout_ elapses
+	 * @return true if the controller can be enabled
+	 */
+	bool waitForReadiness(const common::UpdateInfo& info);
+
 	/// @brief Function that is called every update cycle.
 	/// @param[in] info Timing information
 	void OnUpdate(const common::UpdateInfo& info);
 
+	/// @brief Function that is called once all models were updated in the update cycle
+	/// @details Writes states of all actors that are still pending and publishes messages that collect data
+	/// of all actors, shared by all plugin instances
+	static void OnUpdateEnd();
+
 	/// @brief Pointer to the model.
 	physics::ModelPtr model_ptr_;
 
@@ -86,6 +118,9 @@ private:
 	/// @brief Pointer to the world, for convenience.
 	physics::WorldPtr world_ptr_;
 
+	/// @brief Provides bounding box of the actor for the world geometry
+	hubero::SkeletonBoundsGazebo skeleton_bounds_;
+
 	/// @brief Pointer to the sdf element.
 	sdf::ElementPtr sdf_ptr_;
 
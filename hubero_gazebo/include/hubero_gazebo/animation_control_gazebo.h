@@ -5,6 +5,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 namespace hubero {
 
@@ -50,8 +51,50 @@ protected:
      */
     static const std::map<AnimationType, std::string> animation_name_map_;
 
+    /// @brief Height and roll of the actor that are applied while the animation is executed
+    struct Posture {
+        double pos_z;
+        double rot_roll;
+    };
+
+    /// @brief Data resolved once at initialization, indexed with @ref AnimationType
+    struct AnimationEntry {
+        /// True if the skeleton animation was found
+        bool valid;
+        /// Transitions change the posture gradually, based on the animation progress
+        bool transition;
+        /// Posture of the steady (non-transition) animations
+        Posture posture;
+        gazebo::common::SkeletonAnimation* skeleton_anim_ptr;
+        /// Trajectory reused each time the animation is started
+        gazebo::physics::TrajectoryInfoPtr trajectory_info_ptr;
+
+        AnimationEntry(): valid(false), transition(false), posture{0.0, 0.0}, skeleton_anim_ptr(nullptr) {}
+    };
+
     void setupAnimation(AnimationType animation_type);
 
+    /**
+     * @brief Computes initial and final postures of the active transition according to its initial pose
+     */
+    void computeTransition(const Pose3& pose_initial);
+
+    /**
+     * @brief Interpolates linearly between @ref transition_begin_ and @ref transition_end_
+     */
+    Posture evaluateTransition(double progress) const;
+
+    /// Animation entries indexed with @ref AnimationType
+    std::vector<AnimationEntry> animations_;
+
+    /// Posture at the beginning of the active transition (e.g., sitting down)
+    Posture transition_begin_;
+    /// Posture at the end of the active transition
+    Posture transition_end_;
+
+    /// Rotation about the X axis that corresponds to the roll of the current posture
+    Quaternion rot_roll_;
+
     /// Handy for catching initial pose
     bool animation_configured_recently_;
 
@@ -1,18 +1,78 @@
 #pragma once
 
 #include <gazebo/physics/Actor.hh>
+#include <gazebo/physics/World.hh>
 #include <hubero_interfaces/model_control_base.h>
 
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 namespace hubero {
 
+/**
+ * @brief Gazebo-specific model control, writes states of all actors to the simulator in one pass per iteration
+ *
+ * @details States are collected in a batch shared by all instances. The batch is applied once all actors
+ * that are being controlled have updated in the current iteration. Leftovers (e.g. when some actor skipped
+ * the update) are applied in @ref flush, which should be called once all models were updated in the iteration.
+ *
+ * Linear and angular accelerations are not written since Gazebo's ActorPlugin characters do not handle
+ * dynamics in any kind.
+ */
 class ModelControlGazebo: public ModelControlBase {
 public:
     ModelControlGazebo();
 
     void initialize(gazebo::physics::ActorPtr& actor_ptr, const std::string& frame_id);
+
+    virtual void update(
+        const Pose3& pose,
+        const Vector3& vel_ang,
+        const Vector3& vel_lin,
+        const Vector3& acc_ang,
+        const Vector3& acc_lin
+    ) override;
+
+    /**
+     * @brief Writes all pending states to the simulator; no-op if nothing is pending
+     */
+    static void flush();
+
 protected:
-    // cast is required due to 'error: no matching function for call to ‘bind(<unresolved overloaded function type>'
-    
+    /// @brief Entry of the batch shared among all actors
+    struct BatchEntry {
+        boost::weak_ptr<gazebo::physics::Actor> actor_wptr;
+        ModelState state;
+        /// Channels of the @ref state that have not been written to the simulator yet
+        uint8_t channels;
+        /// Iteration of the recent update
+        uint64_t iteration;
+    };
+
+    /**
+     * @brief Stores given channels of the state in the batch
+     */
+    virtual void apply(const ModelState& state, uint8_t channels) override;
+
+    /**
+     * @brief Applies leftovers of the previous iteration once the @ref iteration changes
+     */
+    static void startBatch(uint64_t iteration);
+
+    gazebo::physics::WorldPtr world_ptr_;
+    /// Index of the entry in the @ref batch_
+    size_t batch_id_;
+
+    static std::vector<BatchEntry> batch_;
+    /// Iteration that the batch is collected in
+    static uint64_t batch_iteration_;
+    /// Number of actors that updated at least once and still exist
+    static size_t batch_active_;
+    /// Number of actors that updated in the current iteration
+    static size_t batch_updated_;
+    /// Number of entries with channels that have not been written yet
+    static size_t batch_pending_;
 }; // class ModelControlGazebo
 
 } // namespace hubero
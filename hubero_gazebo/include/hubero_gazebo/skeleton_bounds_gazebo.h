@@ -0,0 +1,70 @@
+#pragma once
+
+#include <hubero_common/typedefs.h>
+#include <hubero_common/time.h>
+#include <hubero_interfaces/animation_control_base.h>
+#include <gazebo/physics/Actor.hh>
+
+#include <map>
+
+namespace hubero {
+
+/**
+ * @brief Provides axis-aligned bounding box of the Gazebo actor computed from the poses of its skeleton links
+ *
+ * @details Links are sampled only for a while after the animation is started for the first time. Their extents,
+ * expressed in the actor frame, are cached per animation type; afterwards the cached box is only transformed
+ * with the current pose of the actor, which costs as much as transforming its 8 corners
+ */
+class SkeletonBoundsGazebo {
+public:
+	/// Duration of the animation during which the links are sampled, covers typical gait cycle
+	static const double SAMPLING_DURATION;
+
+	/// Links are placed at skeleton joints, so the box is enlarged to cover the body around them
+	static const double LINK_MARGIN;
+
+	SkeletonBoundsGazebo();
+
+	void initialize(const gazebo::physics::ActorPtr& actor_ptr);
+
+	/**
+	 * @brief Computes bounding box of the actor expressed in the world frame
+	 *
+	 * @param animation animation that is currently executed
+	 * @param time current simulation time
+	 * @return empty box if not initialized
+	 */
+	BBox update(const AnimationType& animation, const Time& time);
+
+	/// @brief Returns true if extents of the @ref animation do not need to be sampled anymore
+	bool isCached(const AnimationType& animation) const;
+
+protected:
+	/// @brief Extents of the skeleton in the actor frame
+	struct Extents {
+		Vector3 min;
+		Vector3 max;
+		/// Animation time during which links were sampled
+		double duration;
+		bool valid;
+
+		Extents(): duration(0.0), valid(false) {}
+	};
+
+	/// @brief Extends @ref extents with current poses of the links
+	void sampleLinks(Extents& extents) const;
+
+	/// @brief Transforms box given in the actor frame to the world frame (box is enlarged to stay axis-aligned)
+	static BBox transform(const Extents& extents, const Pose3& pose);
+
+	gazebo::physics::ActorPtr actor_ptr_;
+
+	std::map<AnimationType, Extents> extents_;
+
+	/// Animation and time of the previous @ref update call, used to measure sampling duration
+	AnimationType animation_prev_;
+	Time time_prev_;
+}; // class SkeletonBoundsGazebo
+
+} // namespace hubero
@@ -1,8 +1,14 @@
 #pragma once
 
 #include <hubero_interfaces/world_geometry_base.h>
+#include <hubero_interfaces/utils/actor_registry.h>
+#include <hubero_interfaces/utils/spatial_grid.h>
 #include <gazebo/physics/World.hh>
 #include <gazebo/physics/Model.hh>
+#include <gazebo/physics/RayShape.hh>
+#include <gazebo/common/Events.hh>
+
+#include <unordered_map>
 
 namespace hubero {
 
@@ -19,6 +25,8 @@ public:
 
     /**
      * @brief This method is Gazebo-specific, used for update of the actors velocities etc.
+     *
+     * @details State becomes visible to other actors in the next world iteration
      */
     void updateActor(
         const Pose3& pose,
@@ -31,19 +39,171 @@ public:
 
 	virtual ModelGeometry getModel(const std::string& name) const override;
 
+    virtual ModelGeometry getModel(const ModelHandle& handle) const override;
+
+    /**
+     * @brief Resolves name to the entry that refers either to the actor (by ID) or to the Gazebo model (by pointer)
+     *
+     * @details Handles become stale once the model is deleted from the world
+     */
+    virtual ModelHandle resolveModel(const std::string& name) const override;
+
+    virtual bool isModelValid(const ModelHandle& handle) const override;
+
+    virtual bool getModelPose(const ModelHandle& handle, Pose3& pose) const override;
+
+    virtual std::vector<ModelGeometry> getModelsNearby(
+        const Vector3& position,
+        double radius,
+        bool actors_only = false
+    ) const override;
+
+    virtual std::vector<ModelGeometry> getModelsNearest(
+        const Vector3& position,
+        size_t num,
+        double radius_max = std::numeric_limits<double>::infinity(),
+        bool actors_only = false
+    ) const override;
+
+    /**
+     * @brief Casts rays against collision geometry of the models (using physics engine's broadphase)
+     * and bounding boxes of the actors
+     *
+     * @details Rays are 3D, i.e. they start at the position of the pose and head along its X axis.
+     * Actors whose bounding box contains the origin of the ray (e.g., the one that casts it) are not hit
+     */
+    virtual std::vector<double> castRays(const std::vector<Pose3>& rays, double range_max) const override;
+
+    /**
+     * @brief Checks whether points lie within collision bounding boxes of the models' links or bounding boxes
+     * of the actors
+     */
+    virtual std::vector<bool> checkOccupancy(const std::vector<Vector3>& points) const override;
+
+    /**
+     * @brief Checks whether 3D segments are free of the models' collision geometry and actors
+     *
+     * @details Actors whose bounding box contains any of the points do not block the line of sight
+     */
+    virtual std::vector<bool> checkLineOfSight(const std::vector<std::pair<Vector3, Vector3>>& pairs) const override;
+
 protected:
+    /// @brief Entry of the lookup table that @ref ModelHandle refers to
+    struct ModelHandleEntry {
+        std::string name;
+        /// Actors are not accessible via world pointer, they are referenced by ID in the @ref actor_registry_
+        bool actor;
+        size_t actor_id;
+        /// Does not prevent deletion of the model
+        boost::weak_ptr<gazebo::physics::Model> model_wptr;
+        /// Incremented each time the entry is invalidated
+        uint64_t generation;
+        bool valid;
+    };
+
+    /// Cell size of the grids used for neighbour queries
+    static const double SPATIAL_GRID_CELL_SIZE;
+
+    /// Models with bounding box half-diagonal bigger than this are not stored in the grid but checked one by one
+    static const double SPATIAL_GRID_MODEL_EXTENT_MAX;
+
     ModelGeometry getModel(const gazebo::physics::ModelPtr& model_ptr) const;
 
+    /**
+     * @brief Rebuilds grid of (non-actor) models if it was not rebuilt in the current world iteration
+     */
+    void updateModelGrid() const;
+
+    /**
+     * @brief Publishes actor states written in the previous world iteration (once per iteration)
+     *
+     * @details Called before any access to the @ref actor_registry_ so that all actors
+     * observe the same snapshot during the iteration; also moves actors in the @ref actor_grid_
+     */
+    void updateActorRegistry() const;
+
+    /**
+     * @brief Computes planar distance from the @ref position to the bounding box of the model
+     */
+    static double computeDistance(const Vector3& position, const BBox& box);
+
+    /**
+     * @brief Computes distance along the segment to its first intersection with the models or actors
+     *
+     * @details Must be called with physics engine's update mutex locked
+     * @param actor_extent biggest bounding box half-diagonal among the actors
+     * @param skip_end_actor set to true to ignore actors whose bounding box contains the @ref end
+     * @return length of the segment if nothing was hit
+     */
+    double castSegment(const Vector3& start, const Vector3& end, double actor_extent, bool skip_end_actor) const;
+
+    /// @brief Computes biggest planar bounding box half-diagonal among the actors
+    static double computeActorExtent();
+
+    /**
+     * @brief Computes distance along the segment to the entry point of the box (slab method)
+     *
+     * @return infinity if segment misses the box or starts inside of it
+     */
+    static double computeIntersection(const Vector3& start, const Vector3& dir, double length, const BBox& box);
+
+    /// @brief Returns true if the box is not empty and contains the point
+    static bool isInside(const Vector3& point, const BBox& box);
+
+    /**
+     * @brief Invalidates the handle entry of the model with the given name; subscribed to Gazebo's entity deletion
+     */
+    static void onEntityDeleted(const std::string& name);
+
+    /// @brief Returns the entry that valid @ref handle refers to, nullptr otherwise
+    static const ModelHandleEntry* findHandleEntry(const ModelHandle& handle);
+
+    /// Ray used for queries, created lazily
+    mutable gazebo::physics::RayShapePtr ray_ptr_;
+
     boost::shared_ptr<const gazebo::physics::World> world_ptr_;
 
     /// Name of the actor that poses an instance of this class
     std::string actor_name_;
 
     /**
-     * @brief This map is created as a workaround, see the link below for details
+     * @brief Actors registry is created as a workaround, see the link below for details
      * @details http://answers.gazebosim.org/question/22114/actor-related-information-in-gazebophysicsworldptr-and-collision-of-actors/
      */
-    static std::map<std::string, ModelGeometry> world_actor_data_;
+    static ActorRegistry actor_registry_;
+
+    /// ID of the actor in the @ref actor_registry_ and the @ref actor_grid_
+    size_t actor_id_;
+
+    /// Spatial index of actors, updated with published states in @ref updateActorRegistry
+    static SpatialGrid actor_grid_;
+
+    /**
+     * @defgroup modelhandles Lookup table that model handles refer to, entries are never removed but invalidated
+     * @{
+     */
+    static std::vector<ModelHandleEntry> handle_entries_;
+    /// Maps model name to the index of its entry
+    static std::unordered_map<std::string, size_t> handle_ids_;
+    static gazebo::event::ConnectionPtr handle_deletion_connection_;
+    /// @}
+
+    /**
+     * @defgroup modelgrid Spatial index of models, rebuilt lazily (at most once per world iteration)
+     * @{
+     */
+    static SpatialGrid model_grid_;
+    /// Models stored in the grid, indexed with grid ID
+    static std::vector<gazebo::physics::ModelPtr> model_grid_ptrs_;
+    /// Biggest bounding box half-diagonal among the models stored in the grid
+    static double model_grid_extent_;
+    /// Large models (e.g. ground plane or building) that are not stored in the grid
+    static std::vector<gazebo::physics::ModelPtr> model_large_ptrs_;
+    /// World iteration in which the grid was rebuilt
+    static uint64_t model_grid_iteration_;
+    /// False until the first rebuild
+    static bool model_grid_valid_;
+    /// @}
 };
 
 } // namespace hubero
@@ -6,6 +6,7 @@ namespace gazebo {
 
 ActorPlugin::ActorPlugin():
 	controller_enabled_(false),
+	startup_timeout_(STARTUP_TIMEOUT_DEFAULT),
 	sim_animation_control_ptr_(std::make_shared<hubero::AnimationControlGazebo>()),
 	sim_localisation_ptr_(std::make_shared<hubero::LocalisationGazebo>()),
 	sim_model_control_ptr_(std::make_shared<hubero::ModelControlGazebo>()),
@@ -13,7 +14,8 @@ ActorPlugin::ActorPlugin():
 	ros_node_ptr_(std::make_shared<hubero::Node>("hubero_gazebo_ros_node")),
 	ros_task_ptr_(std::make_shared<hubero::TaskRequestRos>()),
 	ros_nav_ptr_(std::make_shared<hubero::NavigationRos>()),
-	ros_status_ptr_(std::make_shared<hubero::StatusRos>())
+	ros_status_ptr_(std::make_shared<hubero::StatusRos>()),
+	nav_ptr_(ros_nav_ptr_)
 {}
 
 void ActorPlugin::Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) {
@@ -21,6 +23,7 @@ void ActorPlugin::Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) {
 	 * Gazebo plugin-related setup
 	 */
 	sdf_ptr_ = sdf;
+	startup_timeout_ = sdf->Get<double>("startup_timeout", STARTUP_TIMEOUT_DEFAULT).first;
 	model_ptr_ = model;
 	actor_ptr_ = boost::dynamic_pointer_cast<physics::Actor>(model);
 	world_ptr_ = actor_ptr_->GetWorld();
@@ -31,6 +34,7 @@ void ActorPlugin::Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) {
 			std::placeholders::_1)
 		)
 	);
+	connections_.push_back(event::Events::ConnectWorldUpdateEnd(&ActorPlugin::OnUpdateEnd));
 
 	/*
 	 * HuBeRo framework simulator interfaces initialization
@@ -45,6 +49,7 @@ void ActorPlugin::Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) {
 	sim_localisation_ptr_->initialize(ros_node_ptr_->getSimulatorFrame());
 	sim_model_control_ptr_->initialize(actor_ptr_, ros_node_ptr_->getSimulatorFrame());
 	sim_world_geometry_ptr_->initialize(ros_node_ptr_->getSimulatorFrame(), world_ptr_, actor_ptr_->GetName());
+	skeleton_bounds_.initialize(actor_ptr_);
 
 	/*
 	 * Update pose. Note that coordinate system of the human model is different to ROS REP 105
@@ -66,6 +71,7 @@ void ActorPlugin::Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) {
 		ros_node_ptr_->getSimulatorFrame(),
 		sim_localisation_ptr_->getPose()
 	);
+	loadCrowdAvoidance(sdf);
 
 	/*
 	 * HuBeRo framework status interface initialization
@@ -81,7 +87,7 @@ void ActorPlugin::Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) {
 		sim_model_control_ptr_,
 		sim_world_geometry_ptr_,
 		sim_localisation_ptr_,
-		ros_nav_ptr_,
+		nav_ptr_,
 		ros_status_ptr_,
 		ros_task_ptr_
 	);
@@ -94,20 +100,54 @@ void ActorPlugin::Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) {
 	actor_ptr_->SetCustomTrajectory(sim_animation_control_ptr_->getTrajectoryInfo());
 }
 
+void ActorPlugin::loadCrowdAvoidance(sdf::ElementPtr sdf) {
+	if (!sdf->HasElement("crowd_avoidance")) {
+		return;
+	}
+	auto crowd_sdf = sdf->GetElement("crowd_avoidance");
+	auto solver_ptr = hubero::NavigationCrowd::getSharedSolver();
+	auto params = solver_ptr->getParameters();
+	params.radius = crowd_sdf->Get<double>("radius", params.radius).first;
+	params.neighbour_distance = crowd_sdf->Get<double>("neighbour_distance", params.neighbour_distance).first;
+	params.max_neighbours = crowd_sdf->Get<int>("max_neighbours", params.max_neighbours).first;
+	params.time_horizon = crowd_sdf->Get<double>("time_horizon", params.time_horizon).first;
+	params.max_speed = crowd_sdf->Get<double>("max_speed", params.max_speed).first;
+	solver_ptr->setParameters(params);
+
+	nav_ptr_ = std::make_shared<hubero::NavigationCrowd>(ros_nav_ptr_, solver_ptr);
+	std::cout << "\t[ActorPlugin] Crowd avoidance enabled for " << actor_ptr_->GetName() << std::endl;
+}
+
 void ActorPlugin::Reset() {
 
 }
 
+bool ActorPlugin::waitForReadiness(const common::UpdateInfo& info) {
+	hubero::Time time(info.simTime.Double());
+	sim_localisation_ptr_->updateSimulator(actor_ptr_->WorldPose(), time);
+	nav_ptr_->update(
+		sim_localisation_ptr_->getPose(),
+		sim_localisation_ptr_->getVelocityLinear(),
+		sim_localisation_ptr_->getVelocityAngular()
+	);
+
+	if (nav_ptr_->isReady()) {
+		std::cout << "\t[ActorPlugin] " << actor_ptr_->GetName() << " is ready after "
+			<< info.realTime.Double() << " s, controller starting the job!" << std::endl;
+		return true;
+	}
+	// returns seconds since world start
+	if (info.realTime.Double() >= startup_timeout_) {
+		std::cout << "\t[ActorPlugin] " << actor_ptr_->GetName() << " navigation is not ready after "
+			<< startup_timeout_ << " s, controller starting the job anyway!" << std::endl;
+		return true;
+	}
+	return false;
+}
+
 void ActorPlugin::OnUpdate(const common::UpdateInfo& info) {
-	/*
-	 * This is very naive but the most effective way to prepare both ROS and Gazebo for typical operation.
-	 */
 	if (!controller_enabled_) {
-		// returns seconds since plugin load
-		if (info.realTime.Double() >= 8.0 ) {
-			std::cout << "\t[ActorPlugin] Actor controller starting the job!" << std::endl;
-			controller_enabled_ = true;
-		}
+		controller_enabled_ = waitForReadiness(info);
 		return;
 	}
 
@@ -124,7 +164,7 @@ void ActorPlugin::OnUpdate(const common::UpdateInfo& info) {
 		sim_localisation_ptr_->getVelocityLinear(),
 		sim_localisation_ptr_->getAccelerationAngular(),
 		sim_localisation_ptr_->getAccelerationLinear(),
-		hubero::BBox() // FIXME
+		skeleton_bounds_.update(sim_animation_control_ptr_->getActiveAnimation(), time)
 	);
 
 	// TODO: parameterize animation factor, e.g. take from SDF
@@ -132,4 +172,12 @@ void ActorPlugin::OnUpdate(const common::UpdateInfo& info) {
 	actor_ptr_->SetScriptTime(actor_ptr_->ScriptTime() + (hubero_actor_.getDisplacement() * ANIMATION_FACTOR_DEFAULT));
 }
 
+void ActorPlugin::OnUpdateEnd() {
+	// all actors are done in this step; subsequent calls (one per plugin instance) find the batch empty
+	// states of actors that skipped the update are written here, before the next step reads the poses
+	hubero::ModelControlGazebo::flush();
+	hubero::TransformService::flush();
+	hubero::StatusRos::flush();
+}
+
 } // namespace gazebo
@@ -1,5 +1,7 @@
 #include <hubero_gazebo/animation_control_gazebo.h>
 
+#include <algorithm>
+
 namespace hubero {
 
 const std::map<AnimationType, std::string> AnimationControlGazebo::animation_name_map_ = {
@@ -17,6 +19,8 @@ const std::map<AnimationType, std::string> AnimationControlGazebo::animation_nam
 
 AnimationControlGazebo::AnimationControlGazebo():
 	AnimationControlBase::AnimationControlBase(),
+	transition_begin_{0.0, 0.0},
+	transition_end_{0.0, 0.0},
 	animation_configured_recently_(false),
 	animation_pose_initial_(Pose3(0.0, 0.0, 1.0, 0.0, 0.0, 0.0)),
 	standing_height_(1.0) {}
@@ -73,39 +77,56 @@ void AnimationControlGazebo::initialize(
 	standing_height_ = standing_height;
 	skeleton_anims_ = anims;
 
+	// resolve animations once, so starting them requires no lookups nor allocations
+	animations_.assign(ANIMATION_TALK + 1, AnimationEntry());
+	for (const auto& name: animation_name_map_) {
+		auto& entry = animations_.at(name.first);
+		auto skeleton_it = skeleton_anims_.find(name.second);
+		if (skeleton_it == skeleton_anims_.end()) {
+			/* To print available animations:
+			for (auto& x: skeleton_anims_) { std::cout << "Skel. animation: " << x.first << std::endl; }
+			*/
+			std::cout << "[AnimationControlGazebo] Skeleton animation ''" << name.second << "'' not found.\n";
+			continue;
+		}
+		entry.valid = true;
+		entry.skeleton_anim_ptr = skeleton_it->second;
+		entry.trajectory_info_ptr.reset(new gazebo::physics::TrajectoryInfo());
+		entry.trajectory_info_ptr->type = name.second;
+	}
+	// i.e. stand, run etc.
+	animations_.at(ANIMATION_STAND).posture = {standing_height_, ROT_ROLL_STANDING};
+	animations_.at(ANIMATION_WALK).posture = {standing_height_, ROT_ROLL_STANDING};
+	animations_.at(ANIMATION_RUN).posture = {standing_height_, ROT_ROLL_STANDING};
+	animations_.at(ANIMATION_TALK).posture = {standing_height_, ROT_ROLL_STANDING};
+	animations_.at(ANIMATION_LYING).posture = {standing_height_ + POS_Z_LYING_GROUND_DELTA, ROT_ROLL_LYING_GROUND};
+	animations_.at(ANIMATION_SITTING).posture = {standing_height_ + POS_Z_SITTING_DELTA, ROT_ROLL_STANDING};
+	animations_.at(ANIMATION_SIT_DOWN).transition = true;
+	animations_.at(ANIMATION_LIE_DOWN).transition = true;
+	animations_.at(ANIMATION_STAND_UP).transition = true;
+
 	// configure
 	setupAnimation(anim_init);
 }
 
 void AnimationControlGazebo::adjustPose(Pose3& pose, const Time& time_current) {
+	if (static_cast<size_t>(getActiveAnimation()) >= animations_.size() || !animations_[getActiveAnimation()].valid) {
+		return;
+	}
+	const auto& entry = animations_[getActiveAnimation()];
+
 	if (animation_configured_recently_) {
 		animation_pose_initial_ = pose;
 		animation_configured_recently_ = false;
+		if (entry.transition) {
+			computeTransition(pose);
+		} else {
+			rot_roll_ = Quaternion(entry.posture.rot_roll, 0.0, 0.0);
+		}
 	}
 
-	Vector3 pos = pose.Pos();
-	Vector3 rpy = pose.Rot().Euler();
-
-	if (getActiveAnimation() == ANIMATION_LYING) {
-		rpy.X(ROT_ROLL_LYING_GROUND);
-		pos.Z(standing_height_ + POS_Z_LYING_GROUND_DELTA);
-	} else if (getActiveAnimation() == ANIMATION_SITTING) {
-		rpy.X(ROT_ROLL_STANDING);
-		pos.Z(standing_height_ + POS_Z_SITTING_DELTA);
-	} else if (
-		getActiveAnimation() == ANIMATION_WALK
-		|| getActiveAnimation() == ANIMATION_RUN
-		|| getActiveAnimation() == ANIMATION_STAND
-		|| getActiveAnimation() == ANIMATION_TALK
-	) {
-		// i.e. stand, run etc.
-		pos.Z(standing_height_);
-		rpy.X(0.0);
-	} else if (
-		getActiveAnimation() == ANIMATION_SIT_DOWN
-		|| getActiveAnimation() == ANIMATION_LIE_DOWN
-		|| getActiveAnimation() == ANIMATION_STAND_UP
-	) {
+	Posture posture = entry.posture;
+	if (entry.transition) {
 		Time time_so_far = Time::computeDuration(time_begin_, time_current);
 		Time time_range = Time::computeDuration(time_begin_, time_finish_);
 
@@ -118,55 +139,37 @@ void AnimationControlGazebo::adjustPose(Pose3& pose, const Time& time_current) {
 			time_progress = 1.0;
 			anim_finished_ = true;
 		}
-
-		// handle each case separately
-		if (getActiveAnimation() == ANIMATION_SIT_DOWN) {
-			pos.Z(animation_pose_initial_.Pos().Z() + time_progress * POS_Z_SITTING_DELTA);
-		} else if (getActiveAnimation() == ANIMATION_LIE_DOWN) {
-			rpy.X(ROT_ROLL_STANDING + ROT_ROLL_LYING_GROUND * time_progress);
-			double pos_z_diff = (standing_height_ + POS_Z_LYING_GROUND_DELTA)  - animation_pose_initial_.Pos().Z();
-			pos.Z(standing_height_ + (time_progress * pos_z_diff));
-		} else if (getActiveAnimation() == ANIMATION_STAND_UP) {
-			double rot_roll_diff = ROT_ROLL_STANDING - animation_pose_initial_.Rot().Roll();
-			double pos_z_diff = standing_height_ - animation_pose_initial_.Pos().Z();
-			rpy.X(animation_pose_initial_.Rot().X() + (time_progress * rot_roll_diff));
-			pos.Z(animation_pose_initial_.Pos().Z() + (time_progress * pos_z_diff));
-		}
+		posture = evaluateTransition(time_progress);
+		rot_roll_ = Quaternion(posture.rot_roll, 0.0, 0.0);
 	}
 
-	pose.Pos() = pos;
-	pose.Rot() = Quaternion(rpy);
+	// actors move on the plane, so the orientation is composed of the heading and the roll of the posture
+	pose.Pos().Z(posture.pos_z);
+	pose.Rot() = Quaternion(0.0, 0.0, pose.Rot().Yaw()) * rot_roll_;
 }
 
 void AnimationControlGazebo::setupAnimation(AnimationType animation_type) {
-	std::string animation;
-
-	auto it = animation_name_map_.find(animation_type);
-	if (it != animation_name_map_.end()) {
-		animation = it->second;
-	} else {
+	if (static_cast<size_t>(animation_type) >= animations_.size()) {
 		HUBERO_LOG(
 			"[AnimationControlGazebo] Cannot setup animation %d since its literal was not defined\r\n",
 			animation_type
 		);
 		return;
 	}
-
-	/* To print available animations:
-	for (auto& x: skeleton_anims_) { std::cout << "Skel. animation: " << x.first << std::endl; }
-	*/
-
-	if (skeleton_anims_.find(animation) == skeleton_anims_.end()) {
-		std::cout << "[AnimationControlGazebo] Skeleton animation ''" << animation << "'' not found.\n";
+	auto& entry = animations_[animation_type];
+	if (!entry.valid) {
+		HUBERO_LOG(
+			"[AnimationControlGazebo] Cannot setup animation %d since its skeleton animation was not found\r\n",
+			animation_type
+		);
 		return;
 	}
 
 	// compute animation duration
 	Time duration = Time::computeDuration(time_begin_, time_finish_);
 
-	// create custom trajectory
-	trajectory_info_ptr_.reset(new gazebo::physics::TrajectoryInfo());
-	trajectory_info_ptr_->type = animation;
+	// reuse custom trajectory of the animation
+	trajectory_info_ptr_ = entry.trajectory_info_ptr;
 	trajectory_info_ptr_->duration = duration.getTime();
 
 	animation_configured_recently_ = true;
@@ -175,4 +178,34 @@ void AnimationControlGazebo::setupAnimation(AnimationType animation_type) {
 	trajectory_updater_(trajectory_info_ptr_);
 }
 
+void AnimationControlGazebo::computeTransition(const Pose3& pose_initial) {
+	double pos_z_begin = pose_initial.Pos().Z();
+	double pos_z_end = pos_z_begin;
+	double rot_roll_begin = pose_initial.Rot().Roll();
+	double rot_roll_end = rot_roll_begin;
+
+	if (getActiveAnimation() == ANIMATION_SIT_DOWN) {
+		pos_z_end = pos_z_begin + POS_Z_SITTING_DELTA;
+	} else if (getActiveAnimation() == ANIMATION_LIE_DOWN) {
+		rot_roll_begin = ROT_ROLL_STANDING;
+		rot_roll_end = ROT_ROLL_STANDING + ROT_ROLL_LYING_GROUND;
+		pos_z_begin = standing_height_;
+		pos_z_end = standing_height_ + ((standing_height_ + POS_Z_LYING_GROUND_DELTA) - pose_initial.Pos().Z());
+	} else if (getActiveAnimation() == ANIMATION_STAND_UP) {
+		rot_roll_end = ROT_ROLL_STANDING;
+		pos_z_end = standing_height_;
+	}
+
+	transition_begin_ = {pos_z_begin, rot_roll_begin};
+	transition_end_ = {pos_z_end, rot_roll_end};
+}
+
+AnimationControlGazebo::Posture AnimationControlGazebo::evaluateTransition(double progress) const {
+	double t = std::min(std::max(progress, 0.0), 1.0);
+	return {
+		transition_begin_.pos_z + t * (transition_end_.pos_z - transition_begin_.pos_z),
+		transition_begin_.rot_roll + t * (transition_end_.rot_roll - transition_begin_.rot_roll)
+	};
+}
+
 } // namespace hubero
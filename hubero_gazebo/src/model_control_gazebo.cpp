@@ -1,65 +1,117 @@
 #include <hubero_gazebo/model_control_gazebo.h>
-#include <functional>
-#include <gazebo/physics/Link.hh>
 
 namespace hubero {
 
-ModelControlGazebo::ModelControlGazebo(): ModelControlBase::ModelControlBase() {}
+std::vector<ModelControlGazebo::BatchEntry> ModelControlGazebo::batch_;
+uint64_t ModelControlGazebo::batch_iteration_ = std::numeric_limits<uint64_t>::max();
+size_t ModelControlGazebo::batch_active_ = 0;
+size_t ModelControlGazebo::batch_updated_ = 0;
+size_t ModelControlGazebo::batch_pending_ = 0;
+
+ModelControlGazebo::ModelControlGazebo(): ModelControlBase::ModelControlBase(), batch_id_(0) {}
 
 void ModelControlGazebo::initialize(gazebo::physics::ActorPtr& actor_ptr, const std::string& frame_id) {
-    // for simplicity
-    typedef gazebo::physics::Actor GazeboActor;
-    typedef gazebo::physics::Link GazeboLink;
+    world_ptr_ = actor_ptr->GetWorld();
 
-    // NOTE: explicit ignition::math objects given here
-    // NOTE: 2 superfluous arguments are hard-coded here
-    auto fun_world_pose = std::bind(
-        static_cast<void(GazeboActor::*)(const Pose3&, const bool, const bool)>(&GazeboActor::SetWorldPose),
-        actor_ptr,
-        std::placeholders::_1, true, true
-    );
-    auto fun_linear_vel = std::bind(
-        static_cast<void(GazeboActor::*)(const Vector3&)>(&GazeboActor::SetLinearVel),
-        actor_ptr,
-        std::placeholders::_1
-    );
-    auto fun_angular_vel = std::bind(
-        static_cast<void(GazeboActor::*)(const Vector3&)>(&GazeboActor::SetAngularVel),
-        actor_ptr,
-        std::placeholders::_1
-    );
+    BatchEntry entry;
+    entry.actor_wptr = actor_ptr;
+    entry.channels = MODEL_STATE_NONE;
+    entry.iteration = std::numeric_limits<uint64_t>::max();
+    batch_id_ = ModelControlGazebo::batch_.size();
+    ModelControlGazebo::batch_.push_back(entry);
 
     /*
      * Previously GazeboActor::SetLinearAccel and GazeboActor::SetAngularAccel were called but newer Gazebo warns:
      *   [Wrn] [Model.cc:732] Model::SetAngularAccel() is deprecated and has no effect.
      *   Use Link::SetTorque() on the link directly instead.
+     * Force and torque applied to the "Hips" link will not affect character based on Gazebo's ActorPlugin
+     * either since the plugin does not handle dynamics in any kind
      */
-    // Virtual human body skeleton - link name is standardized
-    auto hips_link = actor_ptr->GetLink("Hips");
-    /*
-     * Linear acceleration (force) and angular acceleration (torque) will likely not affect character
-     * based on Gazebo's ActorPlugin since the plugin does not handle dynamics in any kind
-     */
-    auto fun_linear_accel = std::bind(
-        static_cast<void(GazeboLink::*)(const Vector3&)>(&GazeboLink::SetForce),
-        hips_link,
-        std::placeholders::_1
-    );
-    // angular acceleration - torque is updated here
-    auto fun_angular_accel = std::bind(
-        static_cast<void(GazeboLink::*)(const Vector3&)>(&GazeboLink::SetTorque),
-        hips_link,
-        std::placeholders::_1
-    );
+    ModelControlBase::initialize(frame_id, MODEL_STATE_POSE | MODEL_STATE_VEL_ANG | MODEL_STATE_VEL_LIN);
+}
+
+void ModelControlGazebo::update(
+    const Pose3& pose,
+    const Vector3& vel_ang,
+    const Vector3& vel_lin,
+    const Vector3& acc_ang,
+    const Vector3& acc_lin
+) {
+    if (!isInitialized()) {
+        ModelControlBase::update(pose, vel_ang, vel_lin, acc_ang, acc_lin);
+        return;
+    }
+
+    startBatch(world_ptr_->Iterations());
+    // stores changed channels in the batch (if any)
+    ModelControlBase::update(pose, vel_ang, vel_lin, acc_ang, acc_lin);
+
+    BatchEntry& entry = ModelControlGazebo::batch_.at(batch_id_);
+    if (entry.iteration == ModelControlGazebo::batch_iteration_) {
+        return;
+    }
+    if (entry.iteration == std::numeric_limits<uint64_t>::max()) {
+        ModelControlGazebo::batch_active_++;
+    }
+    entry.iteration = ModelControlGazebo::batch_iteration_;
+    ModelControlGazebo::batch_updated_++;
+
+    // all actors are done in this iteration
+    if (ModelControlGazebo::batch_updated_ >= ModelControlGazebo::batch_active_) {
+        flush();
+    }
+}
+
+void ModelControlGazebo::flush() {
+    if (ModelControlGazebo::batch_pending_ == 0) {
+        return;
+    }
+    for (auto& entry: ModelControlGazebo::batch_) {
+        if (entry.channels == MODEL_STATE_NONE) {
+            continue;
+        }
+        auto actor_ptr = entry.actor_wptr.lock();
+        if (actor_ptr) {
+            // NOTE: 2 superfluous arguments are hard-coded here
+            if (entry.channels & MODEL_STATE_POSE) {
+                actor_ptr->SetWorldPose(entry.state.pose, true, true);
+            }
+            if (entry.channels & MODEL_STATE_VEL_LIN) {
+                actor_ptr->SetLinearVel(entry.state.vel_lin);
+            }
+            if (entry.channels & MODEL_STATE_VEL_ANG) {
+                actor_ptr->SetAngularVel(entry.state.vel_ang);
+            }
+        }
+        entry.channels = MODEL_STATE_NONE;
+    }
+    ModelControlGazebo::batch_pending_ = 0;
+}
+
+void ModelControlGazebo::apply(const ModelState& state, uint8_t channels) {
+    BatchEntry& entry = ModelControlGazebo::batch_.at(batch_id_);
+    if (entry.channels == MODEL_STATE_NONE) {
+        ModelControlGazebo::batch_pending_++;
+    }
+    entry.state = state;
+    // accumulates channels in case the same actor updated twice before the flush
+    entry.channels |= channels;
+}
 
-    ModelControlBase::initialize(
-        frame_id,
-        fun_world_pose,
-        fun_linear_vel,
-        fun_angular_vel,
-        fun_linear_accel,
-        fun_angular_accel
-    );
+void ModelControlGazebo::startBatch(uint64_t iteration) {
+    if (iteration == ModelControlGazebo::batch_iteration_) {
+        return;
+    }
+    flush();
+    ModelControlGazebo::batch_iteration_ = iteration;
+    ModelControlGazebo::batch_updated_ = 0;
+    // deleted actors will never update again
+    ModelControlGazebo::batch_active_ = 0;
+    for (const auto& entry: ModelControlGazebo::batch_) {
+        if (entry.iteration != std::numeric_limits<uint64_t>::max() && !entry.actor_wptr.expired()) {
+            ModelControlGazebo::batch_active_++;
+        }
+    }
 }
 
 } // namespace hubero
@@ -0,0 +1,88 @@
+#include <hubero_gazebo/skeleton_bounds_gazebo.h>
+
+#include <algorithm>
+
+namespace hubero {
+
+const double SkeletonBoundsGazebo::SAMPLING_DURATION = 2.0;
+const double SkeletonBoundsGazebo::LINK_MARGIN = 0.1;
+
+SkeletonBoundsGazebo::SkeletonBoundsGazebo(): animation_prev_(ANIMATION_UNDEFINED) {}
+
+void SkeletonBoundsGazebo::initialize(const gazebo::physics::ActorPtr& actor_ptr) {
+	actor_ptr_ = actor_ptr;
+	extents_.clear();
+}
+
+BBox SkeletonBoundsGazebo::update(const AnimationType& animation, const Time& time) {
+	if (!actor_ptr_) {
+		return BBox();
+	}
+	auto& extents = extents_[animation];
+	if (extents.duration < SkeletonBoundsGazebo::SAMPLING_DURATION) {
+		sampleLinks(extents);
+		if (animation == animation_prev_) {
+			extents.duration += Time::computeDuration(time_prev_, time).getTime();
+		}
+	}
+	animation_prev_ = animation;
+	time_prev_ = time;
+
+	if (!extents.valid) {
+		return BBox();
+	}
+	return transform(extents, actor_ptr_->WorldPose());
+}
+
+bool SkeletonBoundsGazebo::isCached(const AnimationType& animation) const {
+	auto it = extents_.find(animation);
+	return it != extents_.end() && it->second.duration >= SkeletonBoundsGazebo::SAMPLING_DURATION;
+}
+
+void SkeletonBoundsGazebo::sampleLinks(Extents& extents) const {
+	auto pose_actor = actor_ptr_->WorldPose();
+	for (const auto& link_ptr: actor_ptr_->GetLinks()) {
+		// position of the link expressed in the actor frame
+		Vector3 pos = pose_actor.Rot().RotateVectorReverse(link_ptr->WorldPose().Pos() - pose_actor.Pos());
+		if (!extents.valid) {
+			extents.min = pos;
+			extents.max = pos;
+			extents.valid = true;
+			continue;
+		}
+		extents.min.Min(pos);
+		extents.max.Max(pos);
+	}
+}
+
+// static
+BBox SkeletonBoundsGazebo::transform(const Extents& extents, const Pose3& pose) {
+	Vector3 margin(
+		SkeletonBoundsGazebo::LINK_MARGIN,
+		SkeletonBoundsGazebo::LINK_MARGIN,
+		SkeletonBoundsGazebo::LINK_MARGIN
+	);
+	Vector3 min_local = extents.min - margin;
+	Vector3 max_local = extents.max + margin;
+
+	Vector3 min_world;
+	Vector3 max_world;
+	for (int i = 0; i < 8; i++) {
+		Vector3 corner(
+			(i & 1) ? max_local.X() : min_local.X(),
+			(i & 2) ? max_local.Y() : min_local.Y(),
+			(i & 4) ? max_local.Z() : min_local.Z()
+		);
+		corner = pose.Pos() + pose.Rot().RotateVector(corner);
+		if (i == 0) {
+			min_world = corner;
+			max_world = corner;
+			continue;
+		}
+		min_world.Min(corner);
+		max_world.Max(corner);
+	}
+	return BBox(min_world, max_world);
+}
+
+} // namespace hubero
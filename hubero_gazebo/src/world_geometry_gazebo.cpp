@@ -1,11 +1,29 @@
 #include <hubero_gazebo/world_geometry_gazebo.h>
 #include <hubero_common/logger.h>
+#include <gazebo/physics/Link.hh>
+#include <gazebo/physics/PhysicsEngine.hh>
+
+#include <algorithm>
+#include <limits>
 
 namespace hubero {
 
-std::map<std::string, ModelGeometry> WorldGeometryGazebo::world_actor_data_;
+const double WorldGeometryGazebo::SPATIAL_GRID_CELL_SIZE = 2.0;
+const double WorldGeometryGazebo::SPATIAL_GRID_MODEL_EXTENT_MAX = 5.0;
+
+ActorRegistry WorldGeometryGazebo::actor_registry_;
+SpatialGrid WorldGeometryGazebo::actor_grid_(WorldGeometryGazebo::SPATIAL_GRID_CELL_SIZE);
+SpatialGrid WorldGeometryGazebo::model_grid_(WorldGeometryGazebo::SPATIAL_GRID_CELL_SIZE);
+std::vector<gazebo::physics::ModelPtr> WorldGeometryGazebo::model_grid_ptrs_;
+double WorldGeometryGazebo::model_grid_extent_ = 0.0;
+std::vector<gazebo::physics::ModelPtr> WorldGeometryGazebo::model_large_ptrs_;
+uint64_t WorldGeometryGazebo::model_grid_iteration_ = 0;
+bool WorldGeometryGazebo::model_grid_valid_ = false;
+std::vector<WorldGeometryGazebo::ModelHandleEntry> WorldGeometryGazebo::handle_entries_;
+std::unordered_map<std::string, size_t> WorldGeometryGazebo::handle_ids_;
+gazebo::event::ConnectionPtr WorldGeometryGazebo::handle_deletion_connection_;
 
-WorldGeometryGazebo::WorldGeometryGazebo(): WorldGeometryBase::WorldGeometryBase() {}
+WorldGeometryGazebo::WorldGeometryGazebo(): WorldGeometryBase::WorldGeometryBase(), actor_id_(0) {}
 
 void WorldGeometryGazebo::initialize(const std::string& world_frame_id) {
     HUBERO_LOG("[WorldGeometryGazebo] use Gazebo version of 'initialize' method!\r\n");
@@ -18,7 +36,12 @@ void WorldGeometryGazebo::initialize(
 ) {
     world_ptr_ = world_ptr;
     actor_name_ = actor_name;
-    WorldGeometryGazebo::world_actor_data_.insert({actor_name, ModelGeometry(actor_name)});
+    actor_id_ = WorldGeometryGazebo::actor_registry_.add(actor_name);
+    if (!WorldGeometryGazebo::handle_deletion_connection_) {
+        WorldGeometryGazebo::handle_deletion_connection_ = gazebo::event::Events::ConnectDeleteEntity(
+            std::bind(&WorldGeometryGazebo::onEntityDeleted, std::placeholders::_1)
+        );
+    }
     WorldGeometryBase::initialize(world_frame_id);
 }
 
@@ -30,18 +53,26 @@ void WorldGeometryGazebo::updateActor(
     const Vector3& acc_lin,
     const BBox& box
 ) {
-    auto it = WorldGeometryGazebo::world_actor_data_.find(actor_name_);
-    if (it == WorldGeometryGazebo::world_actor_data_.end()) {
-        HUBERO_LOG("[WorldGeometryGazebo] Cannot find '%s' actor name in map\r\n", actor_name_.c_str());
+    if (!world_ptr_) {
+        HUBERO_LOG("[WorldGeometryGazebo] Cannot update '%s' actor before initialization\r\n", actor_name_.c_str());
         return;
     }
-    it->second = ModelGeometry(actor_name_, WorldGeometryBase::getFrame(), pose, vel_ang, vel_lin, acc_ang, acc_lin, box);
+    updateActorRegistry();
+    ActorRegistry::State state;
+    state.pose = pose;
+    state.vel_lin = vel_lin;
+    state.vel_ang = vel_ang;
+    state.acc_lin = acc_lin;
+    state.acc_ang = acc_ang;
+    state.box = box;
+    WorldGeometryGazebo::actor_registry_.write(actor_id_, state);
 }
 
 ModelGeometry WorldGeometryGazebo::getModel(const std::string& name) const {
-    auto it = WorldGeometryGazebo::world_actor_data_.find(name);
-    if (it != WorldGeometryGazebo::world_actor_data_.end()) {
-        return it->second;
+    updateActorRegistry();
+    size_t id = 0;
+    if (WorldGeometryGazebo::actor_registry_.findId(name, id)) {
+        return WorldGeometryGazebo::actor_registry_.getModel(id, WorldGeometryBase::getFrame());
     }
     return getModel(world_ptr_->ModelByName(name));
 }
@@ -59,4 +90,463 @@ ModelGeometry WorldGeometryGazebo::getModel(const gazebo::physics::ModelPtr& mod
     );
 }
 
-} // namespace hubero
\ No newline at end of file
+ModelGeometry WorldGeometryGazebo::getModel(const ModelHandle& handle) const {
+    updateActorRegistry();
+    auto entry_ptr = findHandleEntry(handle);
+    if (entry_ptr == nullptr) {
+        return ModelGeometry();
+    }
+    if (entry_ptr->actor) {
+        return WorldGeometryGazebo::actor_registry_.getModel(entry_ptr->actor_id, WorldGeometryBase::getFrame());
+    }
+    return getModel(entry_ptr->model_wptr.lock());
+}
+
+ModelHandle WorldGeometryGazebo::resolveModel(const std::string& name) const {
+    if (!world_ptr_) {
+        return ModelHandle();
+    }
+    ModelHandleEntry entry;
+    entry.name = name;
+    entry.actor = WorldGeometryGazebo::actor_registry_.findId(name, entry.actor_id);
+    if (!entry.actor) {
+        auto model_ptr = world_ptr_->ModelByName(name);
+        if (!model_ptr) {
+            return ModelHandle();
+        }
+        entry.model_wptr = model_ptr;
+    }
+    entry.generation = 0;
+    entry.valid = true;
+
+    auto it = WorldGeometryGazebo::handle_ids_.find(name);
+    if (it == WorldGeometryGazebo::handle_ids_.end()) {
+        size_t id = WorldGeometryGazebo::handle_entries_.size();
+        WorldGeometryGazebo::handle_ids_.insert({name, id});
+        WorldGeometryGazebo::handle_entries_.push_back(entry);
+        return ModelHandle(static_cast<int64_t>(id), entry.generation);
+    }
+    auto& entry_existing = WorldGeometryGazebo::handle_entries_.at(it->second);
+    ModelHandle handle(static_cast<int64_t>(it->second), entry_existing.generation);
+    if (findHandleEntry(handle) != nullptr) {
+        return handle;
+    }
+    // refresh entry of the model that was deleted, existing handles remain stale
+    entry.generation = entry_existing.generation + 1;
+    entry_existing = entry;
+    return ModelHandle(static_cast<int64_t>(it->second), entry.generation);
+}
+
+bool WorldGeometryGazebo::isModelValid(const ModelHandle& handle) const {
+    return findHandleEntry(handle) != nullptr;
+}
+
+bool WorldGeometryGazebo::getModelPose(const ModelHandle& handle, Pose3& pose) const {
+    auto entry_ptr = findHandleEntry(handle);
+    if (entry_ptr == nullptr) {
+        return false;
+    }
+    if (entry_ptr->actor) {
+        updateActorRegistry();
+        pose = WorldGeometryGazebo::actor_registry_.read(entry_ptr->actor_id).pose;
+        return true;
+    }
+    auto model_ptr = entry_ptr->model_wptr.lock();
+    if (!model_ptr) {
+        return false;
+    }
+    pose = model_ptr->WorldPose();
+    return true;
+}
+
+std::vector<ModelGeometry> WorldGeometryGazebo::getModelsNearby(
+    const Vector3& position,
+    double radius,
+    bool actors_only
+) const {
+    std::vector<ModelGeometry> models;
+    std::vector<size_t> ids;
+
+    updateActorRegistry();
+    WorldGeometryGazebo::actor_grid_.queryRadius(position.X(), position.Y(), radius, ids);
+    for (const auto& id: ids) {
+        models.push_back(WorldGeometryGazebo::actor_registry_.getModel(id, WorldGeometryBase::getFrame()));
+    }
+
+    if (actors_only) {
+        return models;
+    }
+
+    updateModelGrid();
+    // model is stored in the grid according to its center, so the search area must cover the biggest extent
+    WorldGeometryGazebo::model_grid_.queryRadius(
+        position.X(),
+        position.Y(),
+        radius + WorldGeometryGazebo::model_grid_extent_,
+        ids
+    );
+    for (const auto& id: ids) {
+        const auto& model_ptr = WorldGeometryGazebo::model_grid_ptrs_.at(id);
+        if (computeDistance(position, model_ptr->BoundingBox()) <= radius) {
+            models.push_back(getModel(model_ptr));
+        }
+    }
+    for (const auto& model_ptr: WorldGeometryGazebo::model_large_ptrs_) {
+        if (computeDistance(position, model_ptr->BoundingBox()) <= radius) {
+            models.push_back(getModel(model_ptr));
+        }
+    }
+    return models;
+}
+
+std::vector<ModelGeometry> WorldGeometryGazebo::getModelsNearest(
+    const Vector3& position,
+    size_t num,
+    double radius_max,
+    bool actors_only
+) const {
+    // distance and index in one of the containers: actors, models from the grid or large models
+    struct Candidate {
+        double distance;
+        int source;
+        size_t index;
+    };
+    std::vector<Candidate> candidates;
+
+    updateActorRegistry();
+    auto actor_neighbours = WorldGeometryGazebo::actor_grid_.queryNearest(position.X(), position.Y(), num, radius_max);
+    for (const auto& neighbour: actor_neighbours) {
+        candidates.push_back({neighbour.second, 0, neighbour.first});
+    }
+
+    if (!actors_only) {
+        updateModelGrid();
+        /*
+         * Models are stored in the grid according to their centers, so the nearest centers do not have to
+         * belong to the nearest bounding boxes. The nearest centers only bound the search: the num-th
+         * bounding box distance among them is not smaller than the num-th smallest one overall, and each model
+         * within that bounding box distance has its center within the bound extended by the biggest extent
+         */
+        auto neighbours = WorldGeometryGazebo::model_grid_.queryNearest(
+            position.X(),
+            position.Y(),
+            num,
+            radius_max + WorldGeometryGazebo::model_grid_extent_
+        );
+        std::vector<size_t> ids;
+        for (const auto& neighbour: neighbours) {
+            ids.push_back(neighbour.first);
+        }
+        // fewer than 'num' centers found means that all models within the search area are known already
+        if (neighbours.size() >= num) {
+            double dist_bound = 0.0;
+            for (const auto& id: ids) {
+                dist_bound = std::max(
+                    dist_bound,
+                    computeDistance(position, WorldGeometryGazebo::model_grid_ptrs_.at(id)->BoundingBox())
+                );
+            }
+            WorldGeometryGazebo::model_grid_.queryRadius(
+                position.X(),
+                position.Y(),
+                std::min(dist_bound, radius_max) + WorldGeometryGazebo::model_grid_extent_,
+                ids
+            );
+        }
+        for (const auto& id: ids) {
+            double dist = computeDistance(position, WorldGeometryGazebo::model_grid_ptrs_.at(id)->BoundingBox());
+            if (dist <= radius_max) {
+                candidates.push_back({dist, 1, id});
+            }
+        }
+        for (size_t i = 0; i < WorldGeometryGazebo::model_large_ptrs_.size(); i++) {
+            double dist = computeDistance(position, WorldGeometryGazebo::model_large_ptrs_.at(i)->BoundingBox());
+            if (dist <= radius_max) {
+                candidates.push_back({dist, 2, i});
+            }
+        }
+    }
+
+    // only the nearest 'num' candidates are ordered
+    size_t num_selected = std::min(num, candidates.size());
+    std::partial_sort(
+        candidates.begin(),
+        candidates.begin() + num_selected,
+        candidates.end(),
+        [](const Candidate& a, const Candidate& b) { return a.distance < b.distance; }
+    );
+    candidates.resize(num_selected);
+
+    std::vector<ModelGeometry> models;
+    for (const auto& candidate: candidates) {
+        if (candidate.source == 0) {
+            models.push_back(WorldGeometryGazebo::actor_registry_.getModel(candidate.index, WorldGeometryBase::getFrame()));
+        } else if (candidate.source == 1) {
+            models.push_back(getModel(WorldGeometryGazebo::model_grid_ptrs_.at(candidate.index)));
+        } else {
+            models.push_back(getModel(WorldGeometryGazebo::model_large_ptrs_.at(candidate.index)));
+        }
+    }
+    return models;
+}
+
+std::vector<double> WorldGeometryGazebo::castRays(const std::vector<Pose3>& rays, double range_max) const {
+    std::vector<double> ranges(rays.size(), range_max);
+    if (rays.empty()) {
+        return ranges;
+    }
+    updateActorRegistry();
+    double actor_extent = computeActorExtent();
+    // whole batch is evaluated against a consistent state of the world
+    boost::recursive_mutex::scoped_lock lock(*world_ptr_->Physics()->GetPhysicsUpdateMutex());
+    for (size_t i = 0; i < rays.size(); i++) {
+        Vector3 end = rays[i].Pos() + rays[i].Rot().RotateVector(Vector3::UnitX) * range_max;
+        ranges[i] = castSegment(rays[i].Pos(), end, actor_extent, false);
+    }
+    return ranges;
+}
+
+std::vector<bool> WorldGeometryGazebo::checkOccupancy(const std::vector<Vector3>& points) const {
+    std::vector<bool> occupied(points.size(), false);
+    if (points.empty()) {
+        return occupied;
+    }
+    updateActorRegistry();
+    updateModelGrid();
+    double actor_extent = computeActorExtent();
+    std::vector<size_t> ids;
+
+    auto is_inside_model = [&](const Vector3& point, const gazebo::physics::ModelPtr& model_ptr) {
+        for (const auto& link_ptr: model_ptr->GetLinks()) {
+            if (isInside(point, link_ptr->CollisionBoundingBox())) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // collision boxes are read under the same lock as in the other batched queries
+    boost::recursive_mutex::scoped_lock lock(*world_ptr_->Physics()->GetPhysicsUpdateMutex());
+    for (size_t i = 0; i < points.size(); i++) {
+        const auto& point = points[i];
+        WorldGeometryGazebo::actor_grid_.queryRadius(point.X(), point.Y(), actor_extent, ids);
+        for (const auto& id: ids) {
+            if (isInside(point, WorldGeometryGazebo::actor_registry_.read(id).box)) {
+                occupied[i] = true;
+                break;
+            }
+        }
+        if (occupied[i]) {
+            continue;
+        }
+        WorldGeometryGazebo::model_grid_.queryRadius(point.X(), point.Y(), WorldGeometryGazebo::model_grid_extent_, ids);
+        for (const auto& id: ids) {
+            if (is_inside_model(point, WorldGeometryGazebo::model_grid_ptrs_.at(id))) {
+                occupied[i] = true;
+                break;
+            }
+        }
+        if (occupied[i]) {
+            continue;
+        }
+        for (const auto& model_ptr: WorldGeometryGazebo::model_large_ptrs_) {
+            if (is_inside_model(point, model_ptr)) {
+                occupied[i] = true;
+                break;
+            }
+        }
+    }
+    return occupied;
+}
+
+std::vector<bool> WorldGeometryGazebo::checkLineOfSight(
+    const std::vector<std::pair<Vector3, Vector3>>& pairs
+) const {
+    std::vector<bool> visible(pairs.size(), true);
+    if (pairs.empty()) {
+        return visible;
+    }
+    updateActorRegistry();
+    double actor_extent = computeActorExtent();
+    boost::recursive_mutex::scoped_lock lock(*world_ptr_->Physics()->GetPhysicsUpdateMutex());
+    for (size_t i = 0; i < pairs.size(); i++) {
+        double length = pairs[i].first.Distance(pairs[i].second);
+        visible[i] = castSegment(pairs[i].first, pairs[i].second, actor_extent, true) >= length;
+    }
+    return visible;
+}
+
+void WorldGeometryGazebo::updateModelGrid() const {
+    uint64_t iteration = world_ptr_->Iterations();
+    if (WorldGeometryGazebo::model_grid_valid_ && WorldGeometryGazebo::model_grid_iteration_ == iteration) {
+        return;
+    }
+    WorldGeometryGazebo::model_grid_.clear();
+    WorldGeometryGazebo::model_grid_ptrs_.clear();
+    WorldGeometryGazebo::model_large_ptrs_.clear();
+    WorldGeometryGazebo::model_grid_extent_ = 0.0;
+
+    for (const auto& model_ptr: world_ptr_->Models()) {
+        // actors are indexed separately
+        size_t actor_id = 0;
+        if (WorldGeometryGazebo::actor_registry_.findId(model_ptr->GetName(), actor_id)) {
+            continue;
+        }
+        auto box = model_ptr->BoundingBox();
+        double extent = 0.5 * std::hypot(box.XLength(), box.YLength());
+        if (extent > WorldGeometryGazebo::SPATIAL_GRID_MODEL_EXTENT_MAX) {
+            WorldGeometryGazebo::model_large_ptrs_.push_back(model_ptr);
+            continue;
+        }
+        auto center = box.Center();
+        WorldGeometryGazebo::model_grid_.update(WorldGeometryGazebo::model_grid_ptrs_.size(), center.X(), center.Y());
+        WorldGeometryGazebo::model_grid_ptrs_.push_back(model_ptr);
+        WorldGeometryGazebo::model_grid_extent_ = std::max(WorldGeometryGazebo::model_grid_extent_, extent);
+    }
+    WorldGeometryGazebo::model_grid_iteration_ = iteration;
+    WorldGeometryGazebo::model_grid_valid_ = true;
+}
+
+// static
+void WorldGeometryGazebo::onEntityDeleted(const std::string& name) {
+    auto it = WorldGeometryGazebo::handle_ids_.find(name);
+    if (it == WorldGeometryGazebo::handle_ids_.end()) {
+        return;
+    }
+    auto& entry = WorldGeometryGazebo::handle_entries_.at(it->second);
+    if (entry.valid) {
+        entry.valid = false;
+        entry.generation++;
+    }
+}
+
+// static
+const WorldGeometryGazebo::ModelHandleEntry* WorldGeometryGazebo::findHandleEntry(const ModelHandle& handle) {
+    if (handle.isNull() || static_cast<size_t>(handle.id) >= WorldGeometryGazebo::handle_entries_.size()) {
+        return nullptr;
+    }
+    const auto& entry = WorldGeometryGazebo::handle_entries_[handle.id];
+    if (!entry.valid || entry.generation != handle.generation) {
+        return nullptr;
+    }
+    // deletion event might have been missed (e.g., models nested in the deleted one)
+    if (!entry.actor && entry.model_wptr.expired()) {
+        return nullptr;
+    }
+    return &entry;
+}
+
+void WorldGeometryGazebo::updateActorRegistry() const {
+    if (!WorldGeometryGazebo::actor_registry_.publish(world_ptr_->Iterations())) {
+        return;
+    }
+    for (size_t id = 0; id < WorldGeometryGazebo::actor_registry_.size(); id++) {
+        if (!WorldGeometryGazebo::actor_registry_.isPublished(id)) {
+            continue;
+        }
+        const auto& pos = WorldGeometryGazebo::actor_registry_.read(id).pose.Pos();
+        WorldGeometryGazebo::actor_grid_.update(id, pos.X(), pos.Y());
+    }
+}
+
+// static
+double WorldGeometryGazebo::computeDistance(const Vector3& position, const BBox& box) {
+    double dx = std::max({box.Min().X() - position.X(), 0.0, position.X() - box.Max().X()});
+    double dy = std::max({box.Min().Y() - position.Y(), 0.0, position.Y() - box.Max().Y()});
+    return std::hypot(dx, dy);
+}
+
+double WorldGeometryGazebo::castSegment(
+    const Vector3& start,
+    const Vector3& end,
+    double actor_extent,
+    bool skip_end_actor
+) const {
+    double length = start.Distance(end);
+    if (length <= 0.0) {
+        return length;
+    }
+    if (!ray_ptr_) {
+        ray_ptr_ = boost::dynamic_pointer_cast<gazebo::physics::RayShape>(
+            world_ptr_->Physics()->CreateShape("ray", gazebo::physics::CollisionPtr())
+        );
+    }
+    double dist = length;
+    if (ray_ptr_) {
+        double intersection = std::numeric_limits<double>::infinity();
+        std::string entity;
+        ray_ptr_->SetPoints(start, end);
+        ray_ptr_->GetIntersection(intersection, entity);
+        if (!entity.empty()) {
+            dist = std::min(dist, intersection);
+        }
+    }
+
+    // actors have no collision geometry, they are checked against the neighbourhood of the segment
+    Vector3 dir = (end - start) / length;
+    Vector3 center = (start + end) / 2.0;
+    std::vector<size_t> ids;
+    WorldGeometryGazebo::actor_grid_.queryRadius(center.X(), center.Y(), length / 2.0 + actor_extent, ids);
+    for (const auto& id: ids) {
+        const auto& box = WorldGeometryGazebo::actor_registry_.read(id).box;
+        if (skip_end_actor && isInside(end, box)) {
+            continue;
+        }
+        dist = std::min(dist, computeIntersection(start, dir, dist, box));
+    }
+    return dist;
+}
+
+// static
+double WorldGeometryGazebo::computeActorExtent() {
+    double extent = 0.0;
+    for (size_t id = 0; id < WorldGeometryGazebo::actor_registry_.size(); id++) {
+        const auto& box = WorldGeometryGazebo::actor_registry_.read(id).box;
+        extent = std::max(extent, 0.5 * std::hypot(box.XLength(), box.YLength()));
+    }
+    return extent;
+}
+
+// static
+double WorldGeometryGazebo::computeIntersection(
+    const Vector3& start,
+    const Vector3& dir,
+    double length,
+    const BBox& box
+) {
+    const double INF = std::numeric_limits<double>::infinity();
+    if (box.XLength() <= 0.0 || box.YLength() <= 0.0 || isInside(start, box)) {
+        return INF;
+    }
+    double t_enter = 0.0;
+    double t_exit = length;
+    for (int axis = 0; axis < 3; axis++) {
+        if (dir[axis] == 0.0) {
+            if (start[axis] < box.Min()[axis] || start[axis] > box.Max()[axis]) {
+                return INF;
+            }
+            continue;
+        }
+        double t1 = (box.Min()[axis] - start[axis]) / dir[axis];
+        double t2 = (box.Max()[axis] - start[axis]) / dir[axis];
+        t_enter = std::max(t_enter, std::min(t1, t2));
+        t_exit = std::min(t_exit, std::max(t1, t2));
+        if (t_enter > t_exit) {
+            return INF;
+        }
+    }
+    return t_enter;
+}
+
+// static
+bool WorldGeometryGazebo::isInside(const Vector3& point, const BBox& box) {
+    // default-constructed boxes (e.g., of the actors that were not updated yet) are degenerate
+    if (box.XLength() <= 0.0 || box.YLength() <= 0.0) {
+        return false;
+    }
+    return point.X() >= box.Min().X() && point.X() <= box.Max().X()
+        && point.Y() >= box.Min().Y() && point.Y() <= box.Max().Y()
+        && point.Z() >= box.Min().Z() && point.Z() <= box.Max().Z();
+}
+
+} // namespace hubero
@@ -2,18 +2,46 @@
 
 #include <hubero_common/logger.h>
 #include <hubero_common/typedefs.h>
+#include <cstdint>
 #include <string>
 #include <functional>
 
 namespace hubero {
 
+/**
+ * @brief Channels of the model state that can be written to the simulator; used as bit flags
+ */
+enum ModelStateChannel: uint8_t {
+	MODEL_STATE_NONE = 0x00,
+	MODEL_STATE_POSE = 0x01,
+	MODEL_STATE_VEL_ANG = 0x02,
+	MODEL_STATE_VEL_LIN = 0x04,
+	MODEL_STATE_ACC_ANG = 0x08,
+	MODEL_STATE_ACC_LIN = 0x10,
+	MODEL_STATE_ALL = 0x1F
+};
+
+/**
+ * @brief State of the model that is written to the simulator in a single update
+ */
+struct ModelState {
+	Pose3 pose;
+	Vector3 vel_ang;
+	Vector3 vel_lin;
+	Vector3 acc_ang;
+	Vector3 acc_lin;
+};
+
 /**
  * @brief Class that acts as a model control interface between simulator software and HuBeRo
- * @details Since each HuBeRo actor poses ModelControlBase he is able to directly control its 'dynamics' in the sim
+ * @details Since each HuBeRo actor poses ModelControlBase he is able to directly control its 'dynamics' in the sim.
+ *
+ * Only the channels that changed since the previous write and that the backend declares as effective
+ * are passed to @ref apply.
  */
 class ModelControlBase {
 public:
-	ModelControlBase(): initialized_(false) {}
+	ModelControlBase(): initialized_(false), channels_(MODEL_STATE_ALL), applied_(false) {}
 
 	virtual void initialize(
 		const std::string& frame_id,
@@ -23,13 +51,12 @@ public:
 		std::function<void(Vector3)> fun_ang_acc,
 		std::function<void(Vector3)> fun_lin_acc
 	) {
-		frame_id_ = frame_id;
 		fun_pose_ = fun_pose;
 		fun_ang_vel_ = fun_ang_vel;
 		fun_lin_vel_ = fun_lin_vel;
 		fun_ang_acc_ = fun_ang_acc;
 		fun_lin_acc_ = fun_lin_acc;
-		initialized_ = true;
+		initialize(frame_id, MODEL_STATE_ALL);
 	}
 
 	virtual void update(
@@ -44,35 +71,23 @@ public:
 			return;
 		}
 
-		if (fun_pose_ != nullptr) {
-			fun_pose_(pose);
-		} else {
-			HUBERO_LOG("[ModelControlBase] Pose not updated since corresponding handler is nullptr\r\n");
-		}
-
-		if (fun_ang_vel_ != nullptr) {
-			fun_ang_vel_(vel_ang);
-		} else {
-			HUBERO_LOG("[ModelControlBase] Angular velocity not updated since corresponding handler is nullptr\r\n");
-		}
-
-		if (fun_lin_vel_ != nullptr) {
-			fun_lin_vel_(vel_lin);
-		} else {
-			HUBERO_LOG("[ModelControlBase] Linear velocity not updated since corresponding handler is nullptr\r\n");
-		}
+		ModelState state;
+		state.pose = pose;
+		state.vel_ang = vel_ang;
+		state.vel_lin = vel_lin;
+		state.acc_ang = acc_ang;
+		state.acc_lin = acc_lin;
 
-		if (fun_ang_acc_ != nullptr) {
-			fun_ang_acc_(acc_ang);
-		} else {
-			HUBERO_LOG("[ModelControlBase] Angular accel not updated since corresponding handler is nullptr\r\n");
+		uint8_t channels = channels_;
+		if (applied_) {
+			channels &= computeChangedChannels(state_applied_, state);
 		}
-
-		if (fun_lin_acc_ != nullptr) {
-			fun_lin_acc_(acc_lin);
-		} else {
-			HUBERO_LOG("[ModelControlBase] Linear accel not updated since corresponding handler is nullptr\r\n");
+		if (channels == MODEL_STATE_NONE) {
+			return;
 		}
+		apply(state, channels);
+		state_applied_ = state;
+		applied_ = true;
 	}
 
 	inline bool isInitialized() const {
@@ -83,14 +98,120 @@ public:
 		return frame_id_;
 	}
 
+	/// @brief Returns bit mask of @ref ModelStateChannel s that affect the model in the simulator
+	inline uint8_t getEffectiveChannels() const {
+		return channels_;
+	}
+
+	/**
+	 * @brief Returns bit mask of @ref ModelStateChannel s that differ between given states
+	 *
+	 * @details Components are compared exactly - tolerances would let small increments accumulate unapplied
+	 */
+	static uint8_t computeChangedChannels(const ModelState& prev, const ModelState& curr) {
+		uint8_t channels = MODEL_STATE_NONE;
+		if (!isEqual(prev.pose.Pos(), curr.pose.Pos())
+			|| prev.pose.Rot().W() != curr.pose.Rot().W()
+			|| prev.pose.Rot().X() != curr.pose.Rot().X()
+			|| prev.pose.Rot().Y() != curr.pose.Rot().Y()
+			|| prev.pose.Rot().Z() != curr.pose.Rot().Z()
+		) {
+			channels |= MODEL_STATE_POSE;
+		}
+		if (!isEqual(prev.vel_ang, curr.vel_ang)) {
+			channels |= MODEL_STATE_VEL_ANG;
+		}
+		if (!isEqual(prev.vel_lin, curr.vel_lin)) {
+			channels |= MODEL_STATE_VEL_LIN;
+		}
+		if (!isEqual(prev.acc_ang, curr.acc_ang)) {
+			channels |= MODEL_STATE_ACC_ANG;
+		}
+		if (!isEqual(prev.acc_lin, curr.acc_lin)) {
+			channels |= MODEL_STATE_ACC_LIN;
+		}
+		return channels;
+	}
+
 	// inline virtual void update(const int& model_name, const Pose3& pose, const Pose3& vel, const Pose3& acc) {}
 
 protected:
+	/**
+	 * @brief Initializes backends that override @ref apply instead of providing handlers
+	 *
+	 * @param channels bit mask of @ref ModelStateChannel s that affect the model in the simulator,
+	 * remaining ones are never passed to @ref apply
+	 */
+	void initialize(const std::string& frame_id, uint8_t channels) {
+		frame_id_ = frame_id;
+		channels_ = channels;
+		applied_ = false;
+		initialized_ = true;
+	}
+
+	/**
+	 * @brief Writes given channels of the state to the simulator
+	 *
+	 * @details Default implementation invokes handlers provided in @ref initialize
+	 */
+	virtual void apply(const ModelState& state, uint8_t channels) {
+		if (channels & MODEL_STATE_POSE) {
+			if (fun_pose_ != nullptr) {
+				fun_pose_(state.pose);
+			} else {
+				HUBERO_LOG("[ModelControlBase] Pose not updated since corresponding handler is nullptr\r\n");
+			}
+		}
+
+		if (channels & MODEL_STATE_VEL_ANG) {
+			if (fun_ang_vel_ != nullptr) {
+				fun_ang_vel_(state.vel_ang);
+			} else {
+				HUBERO_LOG("[ModelControlBase] Angular velocity not updated since corresponding handler is nullptr\r\n");
+			}
+		}
+
+		if (channels & MODEL_STATE_VEL_LIN) {
+			if (fun_lin_vel_ != nullptr) {
+				fun_lin_vel_(state.vel_lin);
+			} else {
+				HUBERO_LOG("[ModelControlBase] Linear velocity not updated since corresponding handler is nullptr\r\n");
+			}
+		}
+
+		if (channels & MODEL_STATE_ACC_ANG) {
+			if (fun_ang_acc_ != nullptr) {
+				fun_ang_acc_(state.acc_ang);
+			} else {
+				HUBERO_LOG("[ModelControlBase] Angular accel not updated since corresponding handler is nullptr\r\n");
+			}
+		}
+
+		if (channels & MODEL_STATE_ACC_LIN) {
+			if (fun_lin_acc_ != nullptr) {
+				fun_lin_acc_(state.acc_lin);
+			} else {
+				HUBERO_LOG("[ModelControlBase] Linear accel not updated since corresponding handler is nullptr\r\n");
+			}
+		}
+	}
+
+	static inline bool isEqual(const Vector3& a, const Vector3& b) {
+		return a.X() == b.X() && a.Y() == b.Y() && a.Z() == b.Z();
+	}
+
 	bool initialized_;
 
 	/// Frame that pose is expressed in
 	std::string frame_id_;
 
+	/// Bit mask of @ref ModelStateChannel s that affect the model in the simulator
+	uint8_t channels_;
+	/// State passed to @ref apply recently
+	ModelState state_applied_;
+	/// False until the first @ref apply call
+	bool applied_;
+
 	std::function<void(Pose3)> fun_pose_;
 	std::function<void(Vector3)> fun_ang_vel_;
 	std::function<void(Vector3)> fun_lin_vel_;
@@ -100,6 +100,15 @@ public:
 		return std::make_tuple(false, pose);
 	}
 
+	/**
+	 * @brief Returns true if @ref computeClosestAchievablePose is cheap enough to be called at every simulation step
+	 *
+	 * @details That is the case when the implementation repairs its previous search instead of planning from scratch
+	 */
+	inline virtual bool isIncrementalPlanningSupported() const {
+		return false;
+	}
+
 	/**
 	 * @brief Randomly chooses a reachable goal
 	 * @details Goal is expressed in global reference frame, see @ref getGlobalReferenceFrame
@@ -112,17 +121,26 @@ public:
 	/**
 	 * @brief Returns TaskFeedbackType
 	 */
-	inline TaskFeedbackType getFeedback() const {
+	inline virtual TaskFeedbackType getFeedback() const {
 		return feedback_;
 	}
 
 	/**
 	 * @brief Returns true if class was initialized successfully
 	 */
-	inline bool isInitialized() const {
+	inline virtual bool isInitialized() const {
 		return initialized_;
 	}
 
+	/**
+	 * @brief Returns true if navigation is able to process goals, e.g., external planners are available
+	 *
+	 * @details Navigation must be updated (see @ref update) to detect readiness
+	 */
+	inline virtual bool isReady() const {
+		return isInitialized();
+	}
+
 	/**
 	 * @brief Returns newest velocity command
 	 */
@@ -4,6 +4,8 @@
 #include <hubero_common/logger.h>
 #include <hubero_interfaces/utils/task_base.h>
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -168,6 +170,59 @@ public:
         return TaskFeedbackType::TASK_FEEDBACK_UNDEFINED;
     }
 
+    /**
+     * @brief Blocks until feedback type of the task differs from @ref feedback_type or @ref timeout elapses
+     * @return feedback type at the moment of return
+     */
+    template <typename Rep, typename Period>
+    TaskFeedbackType waitForTaskFeedbackChange(
+        TaskType task,
+        TaskFeedbackType feedback_type,
+        const std::chrono::duration<Rep, Period>& timeout
+    ) const {
+        auto task_ptr = findTask(task);
+        if (task_ptr == nullptr) {
+            HUBERO_LOG("[TaskRequestBase] Cannot wait for task feedback since task was not defined\r\n");
+            return TaskFeedbackType::TASK_FEEDBACK_UNDEFINED;
+        }
+        return task_ptr->waitForFeedbackChange(feedback_type, timeout);
+    }
+
+    /**
+     * @brief Returns counter of the task events, see @ref TaskBase::getFeedbackEvent
+     */
+    uint64_t getTaskFeedbackEvent(TaskType task) const {
+        auto task_ptr = findTask(task);
+        if (task_ptr == nullptr) {
+            return 0;
+        }
+        return task_ptr->getFeedbackEvent();
+    }
+
+    /**
+     * @brief Blocks until an event of the task newer than @ref event occurs or @ref timeout elapses
+     * @return true if a new event occurred
+     */
+    template <typename Rep, typename Period>
+    bool waitForTaskFeedbackEvent(TaskType task, uint64_t event, const std::chrono::duration<Rep, Period>& timeout) const {
+        auto task_ptr = findTask(task);
+        if (task_ptr == nullptr) {
+            HUBERO_LOG("[TaskRequestBase] Cannot wait for task event since task was not defined\r\n");
+            return false;
+        }
+        return task_ptr->waitForFeedbackEvent(event, timeout);
+    }
+
+    /**
+     * @brief Wakes up threads waiting for the task events
+     */
+    void notifyTaskFeedbackEvent(TaskType task) {
+        auto task_ptr = findTask(task);
+        if (task_ptr != nullptr) {
+            task_ptr->notifyFeedbackEvent();
+        }
+    }
+
     inline bool isInitialized() const {
         return initialized_;
     }
@@ -196,6 +251,17 @@ public:
     }
 
 protected:
+    /**
+     * @brief Returns pointer to the task of the given type or nullptr if it was not defined
+     */
+    std::shared_ptr<TaskBase> findTask(TaskType task) const {
+        auto it = tasks_map_.find(task);
+        if (it == tasks_map_.end()) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
     /// True if at least 1 task was added
     bool initialized_;
 
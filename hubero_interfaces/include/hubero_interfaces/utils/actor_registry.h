@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <hubero_common/typedefs.h>
+#include <hubero_interfaces/utils/model_geometry.h>
+
+namespace hubero {
+
+/**
+ * @brief Registry of actor states indexed with small, dense integer IDs, double-buffered per simulation tick
+ *
+ * @details Names are resolved to IDs once, at registration. During the tick, actors write their states
+ * to the back buffer while all reads are served from the front buffer, i.e. the snapshot published
+ * at the beginning of the tick. Hence, each actor observes the same crowd state regardless of the order
+ * in which actors are updated. The back buffer is published in @ref publish, which is expected to be
+ * called with the current tick number before any other access in that tick.
+ *
+ * All accesses must originate from a single thread (the simulation thread), so no locking is involved.
+ */
+class ActorRegistry {
+public:
+	/// @brief Kinematic state of the actor, expressed in the world frame
+	struct State {
+		Pose3 pose;
+		Vector3 vel_lin;
+		Vector3 vel_ang;
+		Vector3 acc_lin;
+		Vector3 acc_ang;
+		BBox box;
+	};
+
+	ActorRegistry(): tick_(0), tick_valid_(false) {}
+
+	/**
+	 * @brief Registers actor with the given name (if not registered yet)
+	 * @return ID of the actor
+	 */
+	inline size_t add(const std::string& name) {
+		auto it = ids_.find(name);
+		if (it != ids_.end()) {
+			return it->second;
+		}
+		size_t id = names_.size();
+		ids_.insert({name, id});
+		names_.push_back(name);
+		front_.push_back(State());
+		back_.push_back(State());
+		front_written_.push_back(0);
+		back_written_.push_back(0);
+		return id;
+	}
+
+	/**
+	 * @brief Resolves actor name to ID
+	 * @return false if actor with the given name was not registered
+	 */
+	inline bool findId(const std::string& name, size_t& id) const {
+		auto it = ids_.find(name);
+		if (it == ids_.end()) {
+			return false;
+		}
+		id = it->second;
+		return true;
+	}
+
+	/// @brief Returns number of registered actors, IDs are in range [0, size)
+	inline size_t size() const {
+		return names_.size();
+	}
+
+	inline const std::string& getName(size_t id) const {
+		return names_.at(id);
+	}
+
+	/**
+	 * @brief Publishes states written so far if @ref tick differs from the tick of the previous call
+	 * @return true if the back buffer was published
+	 */
+	inline bool publish(uint64_t tick) {
+		if (tick_valid_ && tick == tick_) {
+			return false;
+		}
+		tick_ = tick;
+		tick_valid_ = true;
+		// back buffer keeps the latest states so actors that skip an update do not fall back to the older ones
+		front_ = back_;
+		front_written_ = back_written_;
+		return true;
+	}
+
+	/**
+	 * @brief Stores the state in the back buffer, it becomes visible in the next tick
+	 */
+	inline void write(size_t id, const State& state) {
+		back_.at(id) = state;
+		back_written_.at(id) = 1;
+	}
+
+	/// @brief Returns state of the actor from the published snapshot
+	inline const State& read(size_t id) const {
+		return front_.at(id);
+	}
+
+	/// @brief Returns true if the state of the actor was published at least once
+	inline bool isPublished(size_t id) const {
+		return front_written_.at(id) != 0;
+	}
+
+	/**
+	 * @brief Creates @ref ModelGeometry from the published state of the actor
+	 */
+	inline ModelGeometry getModel(size_t id, const std::string& frame_id) const {
+		const State& state = read(id);
+		return ModelGeometry(
+			names_.at(id),
+			frame_id,
+			state.pose,
+			state.vel_lin,
+			state.vel_ang,
+			state.acc_lin,
+			state.acc_ang,
+			state.box
+		);
+	}
+
+protected:
+	/// Tick in which the back buffer was published recently
+	uint64_t tick_;
+	/// False until the first publication
+	bool tick_valid_;
+
+	std::unordered_map<std::string, size_t> ids_;
+	std::vector<std::string> names_;
+
+	/// @defgroup actorbuffers States indexed with actor ID: published (front) and being written (back)
+	/// @{
+	std::vector<State> front_;
+	std::vector<State> back_;
+	std::vector<uint8_t> front_written_;
+	std::vector<uint8_t> back_written_;
+	/// @}
+}; // class ActorRegistry
+
+} // namespace hubero
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hubero {
+
+/**
+ * @brief Lightweight reference to a model, obtained once with @ref WorldGeometryBase::resolveModel
+ *
+ * @details Points to the entry in the lookup table of the world geometry, so accessing the model
+ * does not involve name lookups. The generation of the entry changes once the model is deleted
+ * (and possibly spawned again), which makes all handles obtained earlier stale
+ */
+struct ModelHandle {
+	/// Index of the entry in the lookup table, negative for null handles
+	int64_t id;
+	/// Generation of the entry at the time of resolution
+	uint64_t generation;
+
+	ModelHandle(int64_t id = -1, uint64_t generation = 0): id(id), generation(generation) {}
+
+	inline bool isNull() const {
+		return id < 0;
+	}
+};
+
+} // namespace hubero
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Planar, binary occupancy grid map, independent of the robotics framework
+ *
+ * @details Cell (0, 0) is located at the origin of the map, the map is not rotated relative to its frame.
+ * Cells are stored row by row, i.e. index of the cell is `y * width + x`
+ */
+class OccupancyGrid {
+public:
+	/// @brief Integer coordinates of the cell
+	struct Cell {
+		int x;
+		int y;
+
+		Cell(int x = 0, int y = 0): x(x), y(y) {}
+
+		inline bool operator==(const Cell& other) const {
+			return x == other.x && y == other.y;
+		}
+
+		inline bool operator!=(const Cell& other) const {
+			return !(*this == other);
+		}
+	};
+
+	OccupancyGrid(): width_(0), height_(0), resolution_(1.0), origin_x_(0.0), origin_y_(0.0) {}
+
+	/**
+	 * @brief Constructs map with all cells free
+	 */
+	OccupancyGrid(int width, int height, double resolution, double origin_x = 0.0, double origin_y = 0.0):
+		width_(width),
+		height_(height),
+		resolution_(resolution),
+		origin_x_(origin_x),
+		origin_y_(origin_y),
+		data_(static_cast<size_t>(width) * height, 0)
+	{}
+
+	inline int getWidth() const {
+		return width_;
+	}
+
+	inline int getHeight() const {
+		return height_;
+	}
+
+	/// @brief Returns size of the cell in meters
+	inline double getResolution() const {
+		return resolution_;
+	}
+
+	inline double getOriginX() const {
+		return origin_x_;
+	}
+
+	inline double getOriginY() const {
+		return origin_y_;
+	}
+
+	/// @brief Returns true if map contains at least one cell
+	inline bool isValid() const {
+		return !data_.empty();
+	}
+
+	inline size_t getIndex(int x, int y) const {
+		return static_cast<size_t>(y) * width_ + x;
+	}
+
+	inline Cell getCell(size_t index) const {
+		return Cell(static_cast<int>(index % width_), static_cast<int>(index / width_));
+	}
+
+	inline bool isInside(int x, int y) const {
+		return x >= 0 && y >= 0 && x < width_ && y < height_;
+	}
+
+	/// @brief Cells outside of the map are treated as occupied
+	inline bool isOccupied(int x, int y) const {
+		return !isInside(x, y) || data_[getIndex(x, y)] != 0;
+	}
+
+	inline bool isOccupied(const Cell& cell) const {
+		return isOccupied(cell.x, cell.y);
+	}
+
+	inline void setOccupied(int x, int y, bool occupied) {
+		if (isInside(x, y)) {
+			data_[getIndex(x, y)] = occupied ? 1 : 0;
+		}
+	}
+
+	/**
+	 * @brief Computes cell that the point (expressed in the map frame) lies in
+	 * @return false if point lies outside of the map (@ref cell is computed anyway)
+	 */
+	inline bool worldToCell(double x, double y, Cell& cell) const {
+		cell.x = static_cast<int>(std::floor((x - origin_x_) / resolution_));
+		cell.y = static_cast<int>(std::floor((y - origin_y_) / resolution_));
+		return isInside(cell.x, cell.y);
+	}
+
+	/**
+	 * @brief Computes coordinates of the cell's center (expressed in the map frame)
+	 */
+	inline void cellToWorld(const Cell& cell, double& x, double& y) const {
+		x = origin_x_ + (cell.x + 0.5) * resolution_;
+		y = origin_y_ + (cell.y + 0.5) * resolution_;
+	}
+
+	/**
+	 * @brief Creates a copy of the map with obstacles enlarged by @ref radius (in meters)
+	 */
+	OccupancyGrid inflate(double radius) const {
+		OccupancyGrid inflated(*this);
+		int r = static_cast<int>(std::ceil(radius / resolution_));
+		if (r <= 0) {
+			return inflated;
+		}
+		// precompute circular stencil
+		std::vector<Cell> stencil;
+		for (int dy = -r; dy <= r; dy++) {
+			for (int dx = -r; dx <= r; dx++) {
+				if (dx * dx + dy * dy <= r * r) {
+					stencil.push_back(Cell(dx, dy));
+				}
+			}
+		}
+		for (int y = 0; y < height_; y++) {
+			for (int x = 0; x < width_; x++) {
+				if (data_[getIndex(x, y)] == 0) {
+					continue;
+				}
+				for (const auto& offset: stencil) {
+					inflated.setOccupied(x + offset.x, y + offset.y, true);
+				}
+			}
+		}
+		return inflated;
+	}
+
+	/**
+	 * @brief Finds free cell closest (in terms of 4-connected steps) to the given one
+	 *
+	 * @param max_distance max number of steps from the @ref cell
+	 * @return false if no free cell was found
+	 */
+	bool findNearestFree(const Cell& cell, int max_distance, Cell& result) const {
+		if (!isOccupied(cell)) {
+			result = cell;
+			return true;
+		}
+		if (!isValid()) {
+			return false;
+		}
+		// search area is typically small compared to the map, so visited cells are not stored densely
+		std::unordered_set<size_t> visited;
+		std::deque<std::pair<Cell, int>> queue;
+		auto push = [&](const Cell& c, int dist) {
+			if (!isInside(c.x, c.y) || !visited.insert(getIndex(c.x, c.y)).second) {
+				return;
+			}
+			queue.push_back({c, dist});
+		};
+		// starting cell may lie outside of the map - then start from the closest cell on the map's border
+		push(Cell(std::min(std::max(cell.x, 0), width_ - 1), std::min(std::max(cell.y, 0), height_ - 1)), 0);
+		while (!queue.empty()) {
+			auto current = queue.front();
+			queue.pop_front();
+			if (!isOccupied(current.first)) {
+				result = current.first;
+				return true;
+			}
+			if (current.second >= max_distance) {
+				continue;
+			}
+			push(Cell(current.first.x + 1, current.first.y), current.second + 1);
+			push(Cell(current.first.x - 1, current.first.y), current.second + 1);
+			push(Cell(current.first.x, current.first.y + 1), current.second + 1);
+			push(Cell(current.first.x, current.first.y - 1), current.second + 1);
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Traverses cells along the ray starting at the point (expressed in the map frame)
+	 *
+	 * @details Visits every cell pierced by the ray (Amanatides-Woo traversal), so the cost depends on
+	 * the number of cells crossed instead of the number of samples. Map border is treated as an obstacle
+	 * @return distance to the first occupied cell, 0 if ray starts in the occupied cell,
+	 * @ref range_max if no obstacle was hit
+	 */
+	double castRay(double x, double y, double yaw, double range_max) const {
+		Cell cell;
+		worldToCell(x, y, cell);
+		if (isOccupied(cell)) {
+			return 0.0;
+		}
+		const double INF = std::numeric_limits<double>::infinity();
+		double dir_x = std::cos(yaw);
+		double dir_y = std::sin(yaw);
+		int step_x = dir_x > 0.0 ? 1 : -1;
+		int step_y = dir_y > 0.0 ? 1 : -1;
+		// distance along the ray between consecutive cell borders
+		double delta_x = dir_x != 0.0 ? resolution_ / std::abs(dir_x) : INF;
+		double delta_y = dir_y != 0.0 ? resolution_ / std::abs(dir_y) : INF;
+		// distance along the ray to the first vertical and horizontal cell border
+		double dist_x = INF;
+		double dist_y = INF;
+		if (dir_x != 0.0) {
+			dist_x = (origin_x_ + (cell.x + (step_x > 0 ? 1 : 0)) * resolution_ - x) / dir_x;
+		}
+		if (dir_y != 0.0) {
+			dist_y = (origin_y_ + (cell.y + (step_y > 0 ? 1 : 0)) * resolution_ - y) / dir_y;
+		}
+		while (true) {
+			double dist = 0.0;
+			if (dist_x < dist_y) {
+				dist = dist_x;
+				dist_x += delta_x;
+				cell.x += step_x;
+			} else {
+				dist = dist_y;
+				dist_y += delta_y;
+				cell.y += step_y;
+			}
+			if (dist >= range_max) {
+				return range_max;
+			}
+			if (isOccupied(cell)) {
+				return dist;
+			}
+		}
+	}
+
+	/// @brief Direct access to cells (0 - free, other - occupied)
+	inline const std::vector<uint8_t>& getData() const {
+		return data_;
+	}
+
+	inline std::vector<uint8_t>& getData() {
+		return data_;
+	}
+
+protected:
+	int width_;
+	int height_;
+	double resolution_;
+	double origin_x_;
+	double origin_y_;
+	std::vector<uint8_t> data_;
+}; // class OccupancyGrid
+
+} // namespace hubero
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Uniform grid spatial hash of planar points identified by small, dense integer IDs
+ *
+ * @details Only occupied cells are stored. Points can be updated incrementally - an entry is moved between cells
+ * only when it crosses a cell boundary. Radius and k-nearest queries visit only cells that may contain results.
+ */
+class SpatialGrid {
+public:
+	/// @brief Result of the k-nearest query: ID and distance
+	typedef std::pair<size_t, double> Neighbour;
+
+	SpatialGrid(double cell_size = 2.0):
+		cell_size_(cell_size),
+		cell_size_inv_(1.0 / cell_size),
+		entries_num_(0)
+	{}
+
+	/**
+	 * @brief Removes all entries, keeps cell size
+	 */
+	inline void clear() {
+		cells_.clear();
+		entries_.clear();
+		entries_num_ = 0;
+	}
+
+	/**
+	 * @brief Inserts a new entry or moves the existing one
+	 */
+	inline void update(size_t id, double x, double y) {
+		if (id >= entries_.size()) {
+			entries_.resize(id + 1);
+		}
+		Entry& entry = entries_[id];
+		int64_t cx = toCellIndex(x);
+		int64_t cy = toCellIndex(y);
+		if (entry.valid && entry.cx == cx && entry.cy == cy) {
+			entry.x = x;
+			entry.y = y;
+			return;
+		}
+		if (entry.valid) {
+			eraseFromCell(id);
+		} else {
+			entries_num_++;
+		}
+		entry.valid = true;
+		entry.x = x;
+		entry.y = y;
+		entry.cx = cx;
+		entry.cy = cy;
+		cells_[computeCellKey(cx, cy)].push_back(id);
+	}
+
+	/**
+	 * @brief Removes entry; does nothing if the entry does not exist
+	 */
+	inline void remove(size_t id) {
+		if (!contains(id)) {
+			return;
+		}
+		eraseFromCell(id);
+		entries_[id].valid = false;
+		entries_num_--;
+	}
+
+	inline bool contains(size_t id) const {
+		return id < entries_.size() && entries_[id].valid;
+	}
+
+	/// @brief Returns number of stored entries
+	inline size_t size() const {
+		return entries_num_;
+	}
+
+	inline double getCellSize() const {
+		return cell_size_;
+	}
+
+	/**
+	 * @brief Collects IDs of all entries located not further than @ref radius from the given point
+	 *
+	 * @details @ref result is cleared first; it is not sorted
+	 */
+	inline void queryRadius(double x, double y, double radius, std::vector<size_t>& result) const {
+		result.clear();
+		if (entries_num_ == 0 || radius < 0.0) {
+			return;
+		}
+		const double radius_sq = radius * radius;
+		const int64_t cx_min = toCellIndex(x - radius);
+		const int64_t cx_max = toCellIndex(x + radius);
+		const int64_t cy_min = toCellIndex(y - radius);
+		const int64_t cy_max = toCellIndex(y + radius);
+
+		// query area bigger than the number of stored cells - it is faster to iterate over the cells directly
+		if (static_cast<double>(cx_max - cx_min + 1) * static_cast<double>(cy_max - cy_min + 1) > cells_.size()) {
+			for (const auto& cell: cells_) {
+				collectInRadius(cell.second, x, y, radius_sq, result);
+			}
+			return;
+		}
+
+		for (int64_t cx = cx_min; cx <= cx_max; cx++) {
+			for (int64_t cy = cy_min; cy <= cy_max; cy++) {
+				auto it = cells_.find(computeCellKey(cx, cy));
+				if (it == cells_.end()) {
+					continue;
+				}
+				collectInRadius(it->second, x, y, radius_sq, result);
+			}
+		}
+	}
+
+	inline std::vector<size_t> queryRadius(double x, double y, double radius) const {
+		std::vector<size_t> result;
+		queryRadius(x, y, radius, result);
+		return result;
+	}
+
+	/**
+	 * @brief Finds up to @ref k entries nearest to the given point, not further than @ref radius_max
+	 *
+	 * @details Cells are visited in rings of increasing size around the query point. Search stops once @ref k
+	 * entries were found and no closer entry can exist in the cells that were not visited yet.
+	 * @return neighbours sorted by distance, ascending
+	 */
+	inline std::vector<Neighbour> queryNearest(
+		double x,
+		double y,
+		size_t k,
+		double radius_max = std::numeric_limits<double>::infinity()
+	) const {
+		if (k == 0 || entries_num_ == 0) {
+			return std::vector<Neighbour>();
+		}
+
+		const int64_t cx0 = toCellIndex(x);
+		const int64_t cy0 = toCellIndex(y);
+		const double radius_max_sq = radius_max * radius_max;
+		auto cmp = [](const Neighbour& a, const Neighbour& b) { return a.second < b.second; };
+		// max-heap of the best candidates (squared distances)
+		std::vector<Neighbour> heap;
+		size_t visited = 0;
+		auto consider = [&](size_t id) {
+			const Entry& entry = entries_[id];
+			double dist_sq = (entry.x - x) * (entry.x - x) + (entry.y - y) * (entry.y - y);
+			if (dist_sq > radius_max_sq) {
+				return;
+			}
+			if (heap.size() < k) {
+				heap.push_back(Neighbour(id, dist_sq));
+				std::push_heap(heap.begin(), heap.end(), cmp);
+			} else if (dist_sq < heap.front().second) {
+				std::pop_heap(heap.begin(), heap.end(), cmp);
+				heap.back() = Neighbour(id, dist_sq);
+				std::push_heap(heap.begin(), heap.end(), cmp);
+			}
+		};
+
+		for (int64_t ring = 0; ; ring++) {
+			// sparse grid - ring would consist of more cells than there are occupied, so check all of them at once
+			if (ring > 0 && static_cast<size_t>(8 * ring) > cells_.size()) {
+				heap.clear();
+				for (const auto& cell: cells_) {
+					for (const auto& id: cell.second) {
+						consider(id);
+					}
+				}
+				break;
+			}
+			// the closest point of the current ring lies at least this far from the query point
+			double ring_dist = std::max(0.0, (ring - 1) * cell_size_);
+			if (ring_dist > radius_max) {
+				break;
+			}
+			if (heap.size() == k && ring_dist * ring_dist > heap.front().second) {
+				break;
+			}
+			if (visited == entries_num_) {
+				break;
+			}
+
+			for (int64_t cx = cx0 - ring; cx <= cx0 + ring; cx++) {
+				// only boundary cells of the ring are visited; inner ones were visited before
+				bool x_edge = (cx == cx0 - ring || cx == cx0 + ring);
+				int64_t cy_step = x_edge ? 1 : std::max<int64_t>(2 * ring, 1);
+				for (int64_t cy = cy0 - ring; cy <= cy0 + ring; cy += cy_step) {
+					auto it = cells_.find(computeCellKey(cx, cy));
+					if (it == cells_.end()) {
+						continue;
+					}
+					for (const auto& id: it->second) {
+						visited++;
+						consider(id);
+					}
+				}
+			}
+		}
+
+		std::sort_heap(heap.begin(), heap.end(), cmp);
+		for (auto& neighbour: heap) {
+			neighbour.second = std::sqrt(neighbour.second);
+		}
+		return heap;
+	}
+
+protected:
+	struct Entry {
+		bool valid;
+		double x;
+		double y;
+		int64_t cx;
+		int64_t cy;
+
+		Entry(): valid(false), x(0.0), y(0.0), cx(0), cy(0) {}
+	};
+
+	inline int64_t toCellIndex(double coord) const {
+		return static_cast<int64_t>(std::floor(coord * cell_size_inv_));
+	}
+
+	static inline uint64_t computeCellKey(int64_t cx, int64_t cy) {
+		// cell indices are limited to 32 bits each, what is plenty for any reasonable cell size
+		return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+	}
+
+	inline void eraseFromCell(size_t id) {
+		const Entry& entry = entries_[id];
+		auto it = cells_.find(computeCellKey(entry.cx, entry.cy));
+		if (it == cells_.end()) {
+			return;
+		}
+		auto& ids = it->second;
+		auto id_it = std::find(ids.begin(), ids.end(), id);
+		if (id_it != ids.end()) {
+			*id_it = ids.back();
+			ids.pop_back();
+		}
+		if (ids.empty()) {
+			cells_.erase(it);
+		}
+	}
+
+	inline void collectInRadius(
+		const std::vector<size_t>& ids,
+		double x,
+		double y,
+		double radius_sq,
+		std::vector<size_t>& result
+	) const {
+		for (const auto& id: ids) {
+			const Entry& entry = entries_[id];
+			if ((entry.x - x) * (entry.x - x) + (entry.y - y) * (entry.y - y) <= radius_sq) {
+				result.push_back(id);
+			}
+		}
+	}
+
+	double cell_size_;
+	double cell_size_inv_;
+	size_t entries_num_;
+
+	/// @brief Occupied cells with IDs of entries located inside
+	std::unordered_map<uint64_t, std::vector<size_t>> cells_;
+
+	/// @brief Entries indexed with ID
+	std::vector<Entry> entries_;
+}; // class SpatialGrid
+
+} // namespace hubero
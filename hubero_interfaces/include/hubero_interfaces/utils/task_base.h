@@ -2,10 +2,18 @@
 
 #include <hubero_common/defines.h>
 #include <hubero_common/typedefs.h>
+#include <hubero_interfaces/utils/task_event_notifier.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <type_traits>
+#include <vector>
 
 namespace hubero {
 
@@ -16,6 +24,10 @@ namespace hubero {
  *   - activation, requested flag erased
  *   - active
  *   - finished, active flag erased
+ *
+ * Feedback type changes are signalled, so other threads (e.g. handlers of external requests) can wait for them
+ * instead of polling, see @ref waitForFeedbackChange and @ref waitForFeedbackEvent. Threads that wait for
+ * events of multiple tasks at once register a shared notifier, see @ref addFeedbackNotifier
  */
 class TaskBase {
 public:
@@ -28,6 +40,7 @@ public:
         aborted_(false),
         finished_(false),
         feedback_type_(TASK_FEEDBACK_UNDEFINED),
+        feedback_event_(0),
         task_args_num_(TASK_ARGS_NUM_DEFAULT) {}
 
 
@@ -45,13 +58,13 @@ public:
             aborted_ = false;
             finished_ = false;
             requested_ = false;
-            feedback_type_ = TASK_FEEDBACK_REJECTED;
+            setFeedbackType(TASK_FEEDBACK_REJECTED);
             return false;
         }
         aborted_ = false;
         finished_ = false;
         requested_ = true;
-        feedback_type_ = TASK_FEEDBACK_PENDING;
+        setFeedbackType(TASK_FEEDBACK_PENDING);
         return true;
     }
 
@@ -101,7 +114,7 @@ public:
         aborted_ = true;
         finished_ = false;
         requested_ = false;
-        feedback_type_ = TASK_FEEDBACK_ABORTED;
+        setFeedbackType(TASK_FEEDBACK_ABORTED);
         return actual_abort_call;
     }
 
@@ -114,7 +127,7 @@ public:
         aborted_ = false;
         // leave finished_ as it is
         requested_ = false;
-        feedback_type_ = TASK_FEEDBACK_ACTIVE;
+        setFeedbackType(TASK_FEEDBACK_ACTIVE);
     }
 
     /**
@@ -126,7 +139,7 @@ public:
         // aborted may be either true or false
         finished_ = true;
         requested_ = false;
-        feedback_type_ = TASK_FEEDBACK_SUCCEEDED;
+        setFeedbackType(TASK_FEEDBACK_SUCCEEDED);
     }
 
     /**
@@ -139,7 +152,7 @@ public:
         aborted_ = false;
         finished_ = false;
         requested_ = false;
-        feedback_type_ = TASK_FEEDBACK_TERMINATED;
+        setFeedbackType(TASK_FEEDBACK_TERMINATED);
     }
 
     TaskType getTaskType() const {
@@ -150,6 +163,59 @@ public:
         return feedback_type_;
     }
 
+    /**
+     * @brief Blocks until the feedback type differs from @ref feedback_type or @ref timeout elapses
+     * @return feedback type at the moment of return
+     */
+    template <typename Rep, typename Period>
+    TaskFeedbackType waitForFeedbackChange(
+        TaskFeedbackType feedback_type,
+        const std::chrono::duration<Rep, Period>& timeout
+    ) const {
+        std::unique_lock<std::mutex> lock(feedback_mutex_);
+        feedback_cv_.wait_for(lock, timeout, [&]() { return feedback_type_ != feedback_type; });
+        return feedback_type_;
+    }
+
+    /**
+     * @brief Returns counter of events related to the task: feedback type changes and @ref notifyFeedbackEvent calls
+     */
+    uint64_t getFeedbackEvent() const {
+        std::lock_guard<std::mutex> lock(feedback_mutex_);
+        return feedback_event_;
+    }
+
+    /**
+     * @brief Blocks until an event newer than @ref event (see @ref getFeedbackEvent) occurs or @ref timeout elapses
+     * @return true if a new event occurred
+     */
+    template <typename Rep, typename Period>
+    bool waitForFeedbackEvent(uint64_t event, const std::chrono::duration<Rep, Period>& timeout) const {
+        std::unique_lock<std::mutex> lock(feedback_mutex_);
+        return feedback_cv_.wait_for(lock, timeout, [&]() { return feedback_event_ != event; });
+    }
+
+    /**
+     * @brief Wakes up threads waiting for the task events, e.g. once an external request related to the task arrived
+     */
+    void notifyFeedbackEvent() {
+        {
+            std::lock_guard<std::mutex> lock(feedback_mutex_);
+            feedback_event_++;
+        }
+        feedback_cv_.notify_all();
+        notifyFeedbackNotifiers();
+    }
+
+    /**
+     * @brief Registers @ref notifier_ptr that will be notified about each event of this task
+     * @details Notifier is held weakly, it is unregistered automatically once it is destroyed
+     */
+    void addFeedbackNotifier(std::shared_ptr<TaskEventNotifier> notifier_ptr) {
+        std::lock_guard<std::mutex> lock(feedback_mutex_);
+        feedback_notifiers_.push_back(notifier_ptr);
+    }
+
     bool isRequested() const {
         return requested_;
     }
@@ -171,6 +237,42 @@ public:
     }
 
 protected:
+    /**
+     * @brief Updates feedback type and wakes up threads waiting for the change
+     */
+    void setFeedbackType(TaskFeedbackType feedback_type) {
+        {
+            std::lock_guard<std::mutex> lock(feedback_mutex_);
+            feedback_type_ = feedback_type;
+            feedback_event_++;
+        }
+        feedback_cv_.notify_all();
+        notifyFeedbackNotifiers();
+    }
+
+    /**
+     * @brief Notifies registered notifiers, drops the ones that were destroyed
+     */
+    void notifyFeedbackNotifiers() {
+        std::vector<std::shared_ptr<TaskEventNotifier>> notifiers;
+        {
+            std::lock_guard<std::mutex> lock(feedback_mutex_);
+            auto it = feedback_notifiers_.begin();
+            while (it != feedback_notifiers_.end()) {
+                auto notifier_ptr = it->lock();
+                if (notifier_ptr == nullptr) {
+                    it = feedback_notifiers_.erase(it);
+                    continue;
+                }
+                notifiers.push_back(notifier_ptr);
+                ++it;
+            }
+        }
+        for (auto& notifier_ptr: notifiers) {
+            notifier_ptr->notify();
+        }
+    }
+
     /**
      * @brief Counts number of arguments of class method
      * @details This method should be used in constructor of specific task to define @ref task_args_num_
@@ -188,7 +290,14 @@ protected:
     bool aborted_;
     bool finished_;
 
-    TaskFeedbackType feedback_type_;
+    /// Written with @ref feedback_mutex_ locked, so waiters do not miss the change
+    std::atomic<TaskFeedbackType> feedback_type_;
+    /// Incremented on each feedback type change and @ref notifyFeedbackEvent call
+    uint64_t feedback_event_;
+    mutable std::mutex feedback_mutex_;
+    mutable std::condition_variable feedback_cv_;
+    /// Notifiers shared with other tasks, see @ref addFeedbackNotifier
+    std::vector<std::weak_ptr<TaskEventNotifier>> feedback_notifiers_;
 
     /**
      * @brief How many arguments are required to be passed to @ref request method - this must be redefined by a specific Task
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace hubero {
+
+/**
+ * @brief Counter of events that a single thread may wait for, while multiple sources signal them
+ *
+ * @details Allows to wait for events of multiple tasks at once: the notifier is registered in each of them
+ * (see @ref TaskBase::addFeedbackNotifier)
+ */
+class TaskEventNotifier {
+public:
+    TaskEventNotifier(): event_(0) {}
+
+    /**
+     * @brief Returns counter of the events notified so far
+     */
+    uint64_t getEvent() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return event_;
+    }
+
+    /**
+     * @brief Blocks until an event newer than @ref event (see @ref getEvent) occurs or @ref timeout elapses
+     * @return true if a new event occurred
+     */
+    template <typename Rep, typename Period>
+    bool wait(uint64_t event, const std::chrono::duration<Rep, Period>& timeout) const {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]() { return event_ != event; });
+    }
+
+    /**
+     * @brief Increments the counter and wakes up the waiting threads
+     */
+    void notify() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            event_++;
+        }
+        cv_.notify_all();
+    }
+
+protected:
+    uint64_t event_;
+    mutable std::mutex mutex_;
+    mutable std::condition_variable cv_;
+}; // class TaskEventNotifier
+
+} // namespace hubero
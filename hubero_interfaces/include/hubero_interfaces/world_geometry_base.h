@@ -1,9 +1,16 @@
 #pragma once
 
+#include <cmath>
+#include <limits>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 #include <hubero_common/typedefs.h>
 #include <hubero_common/logger.h>
 #include <hubero_interfaces/utils/model_geometry.h>
+#include <hubero_interfaces/utils/model_handle.h>
+#include <hubero_interfaces/utils/occupancy_grid.h>
 
 namespace hubero {
 
@@ -32,6 +39,159 @@ public:
 		return ModelGeometry(name, getFrame());
 	}
 
+	/**
+	 * @brief Resolves the name of the model (or actor) to the handle that allows to access the model
+	 * without name lookups; resolution should be performed once, e.g., in the first update after the task is requested
+	 *
+	 * @note Handle tables are not guarded, hence this must be called from the simulation thread
+	 *
+	 * @details Default implementation only stores names, so accessing the model by handle costs as much
+	 * as the @ref getModel call with the name
+	 * @return null handle if the model does not exist
+	 */
+	virtual ModelHandle resolveModel(const std::string& name) const {
+		if (!isInitialized()) {
+			return ModelHandle();
+		}
+		for (size_t i = 0; i < handle_names_.size(); i++) {
+			if (handle_names_[i] == name) {
+				return ModelHandle(static_cast<int64_t>(i));
+			}
+		}
+		handle_names_.push_back(name);
+		return ModelHandle(static_cast<int64_t>(handle_names_.size() - 1));
+	}
+
+	/**
+	 * @brief Returns false if handle is null or stale, i.e. the model it refers to was deleted
+	 */
+	virtual bool isModelValid(const ModelHandle& handle) const {
+		return !handle.isNull() && static_cast<size_t>(handle.id) < handle_names_.size();
+	}
+
+	/**
+	 * @brief Retrieves model referenced by the @ref handle, empty model if the handle is not valid
+	 */
+	virtual ModelGeometry getModel(const ModelHandle& handle) const {
+		if (!WorldGeometryBase::isModelValid(handle)) {
+			return ModelGeometry();
+		}
+		return getModel(handle_names_[handle.id]);
+	}
+
+	/**
+	 * @brief Retrieves only the pose of the model referenced by the @ref handle (the cheapest access)
+	 * @return false if the handle is not valid
+	 */
+	virtual bool getModelPose(const ModelHandle& handle, Pose3& pose) const {
+		if (!WorldGeometryBase::isModelValid(handle)) {
+			return false;
+		}
+		pose = getModel(handle).getPose();
+		return true;
+	}
+
+	/**
+	 * @brief Retrieves models (including actors) located not further than @ref radius from the @ref position
+	 *
+	 * @details Only planar distance is considered. Results are not sorted
+	 * @param actors_only set to true to skip models that are not actors
+	 */
+	virtual std::vector<ModelGeometry> getModelsNearby(
+		const Vector3& position,
+		double radius,
+		bool actors_only = false
+	) const {
+		return std::vector<ModelGeometry>();
+	}
+
+	/**
+	 * @brief Retrieves up to @ref num models (including actors) that are closest to the @ref position
+	 *
+	 * @details Only planar distance is considered. Results are sorted by distance, ascending
+	 * @param radius_max models located further than this are not considered
+	 * @param actors_only set to true to skip models that are not actors
+	 */
+	virtual std::vector<ModelGeometry> getModelsNearest(
+		const Vector3& position,
+		size_t num,
+		double radius_max = std::numeric_limits<double>::infinity(),
+		bool actors_only = false
+	) const {
+		return std::vector<ModelGeometry>();
+	}
+
+	/**
+	 * @brief Sets static map used by the default (grid-based) implementation of batched queries
+	 *
+	 * @details Map must be expressed in the world frame (see @ref getFrame); it is shared, not copied.
+	 * Simulator-specific implementations may ignore it
+	 */
+	inline void setOccupancyGrid(const std::shared_ptr<const OccupancyGrid>& map_ptr) {
+		map_ptr_ = map_ptr;
+	}
+
+	inline std::shared_ptr<const OccupancyGrid> getOccupancyGrid() const {
+		return map_ptr_;
+	}
+
+	/**
+	 * @brief Casts rays, each starting at the position of the pose and heading along its X axis
+	 *
+	 * @details Default implementation traverses the occupancy grid, so only positions and yaws are considered
+	 * @return distances to the first obstacle hit by each ray, @ref range_max for rays that hit nothing;
+	 * rays are not blocked when no map is available
+	 */
+	virtual std::vector<double> castRays(const std::vector<Pose3>& rays, double range_max) const {
+		std::vector<double> ranges(rays.size(), range_max);
+		if (!map_ptr_) {
+			return ranges;
+		}
+		for (size_t i = 0; i < rays.size(); i++) {
+			ranges[i] = map_ptr_->castRay(rays[i].Pos().X(), rays[i].Pos().Y(), rays[i].Rot().Yaw(), range_max);
+		}
+		return ranges;
+	}
+
+	/**
+	 * @brief Checks whether points are occupied by obstacles
+	 *
+	 * @details Default implementation considers only planar coordinates. Points outside of the map
+	 * are treated as occupied; when no map is available all points are free
+	 */
+	virtual std::vector<bool> checkOccupancy(const std::vector<Vector3>& points) const {
+		std::vector<bool> occupied(points.size(), false);
+		if (!map_ptr_) {
+			return occupied;
+		}
+		OccupancyGrid::Cell cell;
+		for (size_t i = 0; i < points.size(); i++) {
+			map_ptr_->worldToCell(points[i].X(), points[i].Y(), cell);
+			occupied[i] = map_ptr_->isOccupied(cell);
+		}
+		return occupied;
+	}
+
+	/**
+	 * @brief Checks whether straight segments between pairs of points are free of obstacles
+	 *
+	 * @details Points are expected to lie in free space (e.g., positions of the actors).
+	 * When no map is available all pairs are visible
+	 */
+	virtual std::vector<bool> checkLineOfSight(const std::vector<std::pair<Vector3, Vector3>>& pairs) const {
+		std::vector<bool> visible(pairs.size(), true);
+		if (!map_ptr_) {
+			return visible;
+		}
+		for (size_t i = 0; i < pairs.size(); i++) {
+			double dx = pairs[i].second.X() - pairs[i].first.X();
+			double dy = pairs[i].second.Y() - pairs[i].first.Y();
+			double dist = std::hypot(dx, dy);
+			visible[i] = map_ptr_->castRay(pairs[i].first.X(), pairs[i].first.Y(), std::atan2(dy, dx), dist) >= dist;
+		}
+		return visible;
+	}
+
 	inline bool isInitialized() const {
         return initialized_;
     }
@@ -39,6 +199,10 @@ public:
 protected:
 	bool initialized_;
 	std::string frame_id_;
+	/// Static map for the default implementation of batched queries, may be null
+	std::shared_ptr<const OccupancyGrid> map_ptr_;
+	/// Names of the models resolved by the default implementation of @ref resolveModel, indexed with handle ID
+	mutable std::vector<std::string> handle_names_;
 };
 
 } // namespace hubero
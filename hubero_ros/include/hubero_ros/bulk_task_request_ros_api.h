@@ -0,0 +1,129 @@
+#pragma once
+
+#include <hubero_common/defines.h>
+#include <hubero_common/typedefs.h>
+
+#include <hubero_ros/node.h>
+
+#include <hubero_ros_msgs/RequestTasksAction.h>
+#include <hubero_ros_msgs/TaskGoal.h>
+#include <hubero_ros_msgs/TaskStatus.h>
+
+#include <actionlib/client/simple_action_client.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Client of the bulk task request action, allows to request tasks from multiple actors in a single message
+ *
+ * @details The action is served by @ref TaskRequestRos instances of all actors simulated in a single process,
+ * therefore, a single instance of this class per scenario executable is sufficient. Tasks are submitted in a single
+ * goal - either all of them are requested or none (e.g., if any actor or task is unknown). Since the bulk request
+ * is served separately from the per-actor actions (see @ref TaskRequestRosApi), @ref getTasksStatus is the only
+ * status source for the tasks requested this way.
+ *
+ * @note The action server executes a single goal at a time: a new request preempts the previous one, so tasks
+ * of the previous request that are still running are aborted
+ */
+class BulkTaskRequestRosApi {
+public:
+	/**
+	 * @brief Constructor, does not block - use @ref waitForReady to synchronize with the connection
+	 */
+	BulkTaskRequestRosApi();
+
+	virtual ~BulkTaskRequestRosApi() = default;
+
+	/**
+	 * @brief Blocks until the action server is connected
+	 *
+	 * @param timeout maximum waiting time in seconds, negative value means no limit
+	 * @return true if the action server is connected
+	 */
+	bool waitForReady(double timeout = -1.0) const;
+
+	/**
+	 * @brief Returns true if the action server is connected (non-blocking)
+	 */
+	inline bool isReady() const {
+		return waitForReady(0.0);
+	}
+
+	/**
+	 * @brief Creates entry of the bulk task request for the actor named @ref actor_name
+	 * @details Objective arguments that are not used by the task given by @ref task_type are ignored
+	 */
+	static hubero_ros_msgs::TaskGoal createTaskGoal(
+		const std::string& actor_name,
+		TaskType task_type,
+		const Vector3& pos = Vector3(),
+		const double& yaw = 0.0,
+		const std::string& frame_id = std::string(),
+		const std::string& object_name = std::string()
+	);
+
+	/**
+	 * @brief Requests @ref tasks from multiple actors in a single message
+	 */
+	bool requestTasks(const std::vector<hubero_ros_msgs::TaskGoal>& tasks);
+
+	/**
+	 * @brief Aborts execution of all tasks of the bulk request
+	 */
+	bool cancelTasks();
+
+	/**
+	 * @brief Blocks until all tasks of the bulk request finish
+	 *
+	 * @param timeout maximum waiting time in seconds, non-positive value means no limit
+	 * @return true if the bulk request finished before the timeout
+	 */
+	bool waitForTasks(double timeout = 0.0);
+
+	/**
+	 * @brief Returns most recent statuses of the tasks of the bulk request, in the order of request
+	 */
+	std::vector<hubero_ros_msgs::TaskStatus> getTasksStatus() const;
+
+	/**
+	 * @brief Returns most recent state of the task requested from @ref actor_name in the bulk request
+	 *
+	 * @details Returns TASK_FEEDBACK_UNDEFINED if the actor is not a part of the most recent request
+	 */
+	TaskFeedbackType getTaskState(const std::string& actor_name) const;
+
+	/**
+	 * @brief Returns most recent description of the bulk request state
+	 */
+	std::string getTasksStateDescription() const;
+
+protected:
+	/// Alias declaration
+	typedef actionlib::SimpleActionClient<hubero_ros_msgs::RequestTasksAction> ActionClient;
+
+	std::shared_ptr<Node> node_ptr_;
+	std::shared_ptr<ActionClient> ac_request_tasks_ptr_;
+
+	/// Guards statuses of the bulk request, updated from the action client callbacks
+	mutable std::mutex tasks_mutex_;
+	std::vector<hubero_ros_msgs::TaskStatus> tasks_status_;
+	std::string tasks_state_txt_;
+
+	/**
+	 * @defgroup requesttaskscallbacks Callbacks of the bulk task request action client
+	 * @{
+	 */
+	void callbackTasksFeedback(const hubero_ros_msgs::RequestTasksFeedbackConstPtr& feedback);
+	void callbackTasksDone(
+		const actionlib::SimpleClientGoalState& state,
+		const hubero_ros_msgs::RequestTasksResultConstPtr& result
+	);
+	/// @}
+}; // class BulkTaskRequestRosApi
+
+} // namespace hubero
@@ -1,23 +1,35 @@
 #pragma once
 
 #include <hubero_interfaces/navigation_base.h>
+#include <hubero_core/navigation/goal_prefetcher.h>
+#include <hubero_core/planning/dstar_lite.h>
+#include <hubero_core/planning/flow_field_cache.h>
+#include <hubero_core/planning/path.h>
+#include <hubero_core/planning/region_graph_planner.h>
+#include <hubero_core/planning/roadmap.h>
+#include <hubero_core/planning/static_map_cache.h>
 #include <hubero_ros/node.h>
+#include <hubero_ros/utils/publication_governor.h>
+#include <hubero_ros/utils/transform_service.h>
+#include <hubero_ros/utils/triple_buffer.h>
 
 #include <ros/ros.h>
 #include <actionlib/client/simple_action_client.h>
 #include <tf2_ros/transform_broadcaster.h>
-#include <tf2_ros/buffer.h>
-#include <tf2_ros/transform_listener.h>
 #include <nav_msgs/GetPlan.h>
+#include <nav_msgs/OccupancyGrid.h>
 #include <nav_msgs/Odometry.h>
 #include <geometry_msgs/Twist.h>
 #include <move_base_msgs/MoveBaseAction.h>
 #include <move_base_msgs/MoveBaseActionFeedback.h>
 #include <move_base_msgs/MoveBaseActionResult.h>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <tuple>
+#include <vector>
 
 namespace hubero {
 
@@ -42,6 +54,18 @@ public:
 	 */
 	static const int QUATERNION_RANDOM_RETRY_NUM;
 
+	/**
+	 * Defines how far (in meters) the actor can move away from the cell that the incremental planner's search
+	 * is rooted at; once exceeded, the search is restarted
+	 */
+	static const double PLANNER_REROOT_DISTANCE;
+
+	/// Gain of the angular velocity command that turns the actor towards the flow field waypoint
+	static const double FLOW_FIELD_HEADING_GAIN;
+
+	/// Period (in seconds) of checks whether the plan service exists; each check queries ROS master
+	static const double SERVICE_CHECK_PERIOD;
+
 	/**
 	 * @brief Constructor
 	 */
@@ -87,6 +111,9 @@ public:
 	/**
 	 * @brief Set the goal
 	 *
+	 * @details With flow field navigation enabled, goals located on the static map are pursued by descending
+	 * the flow field shared among all actors heading to the same place; navigation stack is not involved then
+	 *
 	 * @param pose
 	 * @param frame
 	 * @return true
@@ -109,11 +136,22 @@ public:
 
 	/**
 	 * @brief Computes reachable pose that is closest to the given pose, starting from current pose from update call
+	 *
+	 * @details Once the static map is received, the incremental planner is used instead of the navigation stack
+	 * service. The planner reuses results of the previous calls, so it is cheap to call it at every step
 	 */
 	virtual std::tuple<bool, Pose3> computeClosestAchievablePose(const Pose3& pose, const std::string& frame) override;
 
+	/**
+	 * @brief Returns true once the static map was received and the incremental planner can be used
+	 */
+	virtual bool isIncrementalPlanningSupported() const override;
+
 	/**
 	 * @brief Randomly chooses a reachable goal
+	 *
+	 * @details Once the static map is received (and roadmap is enabled), goal is drawn from the roadmap
+	 * with @ref findRandomReachableGoalRoadmap instead of sampling the map bounds and requesting plans
 	 */
 	virtual std::tuple<bool, Pose3> findRandomReachableGoal() override;
 
@@ -124,6 +162,19 @@ public:
 	 */
 	virtual Vector3 getVelocityCmd() const override;
 
+	/**
+	 * @brief Returns the most recent navigation feedback, set either in the simulation thread or in ROS callbacks
+	 *
+	 * @details Must be called from the simulation thread (see @ref TripleBuffer::read)
+	 */
+	virtual TaskFeedbackType getFeedback() const override;
+
+	/**
+	 * @brief Returns true once the move_base action server is connected, the plan service exists
+	 * and the TF chain from the world frame to the actor is available
+	 */
+	virtual bool isReady() const override;
+
 	/**
 	 * @brief How far from the goal (in meters) the actor can be located to treat goal as reached
 	 */
@@ -164,8 +215,25 @@ protected:
 	void callbackResult(const move_base_msgs::MoveBaseActionResult::ConstPtr& msg);
 	/// @}
 
+	/**
+	 * @brief Callback for static map retrieval; map is converted and inflated for the incremental planner
+	 */
+	void callbackMap(const nav_msgs::OccupancyGrid::ConstPtr& msg);
+
+	/**
+	 * @brief Publishes odometry message, velocities are expressed in the actor base frame
+	 */
+	void publishOdometry(const Pose3& pose, const Vector3& vel_lin, const Vector3& vel_ang, const ros::Time& stamp);
+
+	/**
+	 * @brief Publishes transforms of the actor's TF tree: global reference -> local reference -> base
+	 */
+	void publishTransforms(const Pose3& pose, const ros::Time& stamp);
+
 	/**
 	 * @brief Finds transform between coordinate systems using ROS TF buffer
+	 *
+	 * @details Uses process-wide @ref TransformService, see @ref TransformService::findTransform
 	 * @return std::tuple<bool, Pose3> first element is true if transform (second elem) is valid
 	 */
 	std::tuple<bool, Pose3> findTransform(const std::string& frame_source, const std::string& frame_target) const;
@@ -173,21 +241,93 @@ protected:
 	/**
 	 * @brief Computes plan from start to goal using ROS service call
 	 *
+	 * @details Once the static map is received (and hierarchical planning is enabled while the roadmap is not),
+	 * plan is computed locally with @ref computePlanHierarchical instead.
 	 * Returns plan in the world frame
 	 */
-	nav_msgs::Path computePlan(
+	Path computePlan(
 		const Pose3& start_pose,
 		const std::string& start_frame,
 		const Pose3& goal_pose,
 		const std::string& goal_frame
 	);
 
+	/**
+	 * @brief Computes plan from start to goal with the region graph planner on the static map
+	 *
+	 * @details Start and goal are moved to the closest free cells (within the plan tolerance). As in plans returned
+	 * by the ROS service, the requested goal pose is appended at the end of the plan.
+	 * Returns plan in the world frame
+	 */
+	Path computePlanHierarchical(
+		const Pose3& start_pose,
+		const std::string& start_frame,
+		const Pose3& goal_pose,
+		const std::string& goal_frame
+	);
+
+	/**
+	 * @brief Passes the most recently received map (if any) to the planners
+	 */
+	void updateMap();
+
+	/**
+	 * @brief Tries to obtain the flow field of the goal located on the static map
+	 *
+	 * @return true if the goal is reachable from the current pose and flow field navigation was started
+	 */
+	bool setGoalFlowField(const Pose3& pose, const std::string& frame);
+
+	/**
+	 * @brief Computes velocity command that moves the actor down the flow field, updates feedback
+	 *
+	 * @details Pose must be expressed in the world frame
+	 */
+	void updateFlowField(const Pose3& pose);
+
+	/**
+	 * @brief Stops flow field navigation (if active) and zeroes the velocity command
+	 *
+	 * @return true if flow field navigation was active
+	 */
+	bool stopFlowField();
+
+	/**
+	 * @brief Draws a goal among the roadmap nodes connected with the current pose
+	 *
+	 * @details Goal prefetched in the background is used if the actor reached the previous goal.
+	 * Returned pose is expressed in the global reference frame
+	 */
+	std::tuple<bool, Pose3> findRandomReachableGoalRoadmap();
+
+	/**
+	 * @brief Draws a goal among the roadmap nodes reachable from the @ref start
+	 *
+	 * @details Goal is oriented along the last segment of the roadmap path leading to it. Does not modify
+	 * the map nor the roadmap, so it is also called by the goal prefetcher threads.
+	 * Poses are expressed in the global reference frame
+	 */
+	static std::tuple<bool, Pose3> sampleGoalRoadmap(
+		const OccupancyGrid& map,
+		const Roadmap& roadmap,
+		const Pose3& start,
+		double tolerance,
+		std::mt19937& gen
+	);
+
 	/**
 	 * @brief Evaluates if a planned path contains a valid goal
 	 *
 	 * @return std::tuple<bool, Pose3> Bool: True if @ref Pose3 element of tuple can be treated as a valid goal
 	 */
-	std::tuple<bool, Pose3> selectGoalFromPlan(const nav_msgs::Path& path);
+	std::tuple<bool, Pose3> selectGoalFromPlan(const Path& path);
+
+	/**
+	 * @brief Computes reachable pose that is closest to the given pose using the incremental planner
+	 *
+	 * @details Returned pose is expressed in the world frame, it is oriented along the last segment of the path
+	 */
+	std::tuple<bool, Pose3> computeClosestAchievablePoseIncremental(const Pose3& pose, const std::string& frame);
 
 	/**
 	 * @defgroup rosinterface ROS interface
@@ -200,6 +340,8 @@ protected:
 	ros::Subscriber sub_feedback_;
 	/// @brief Subscriber of the move_base simple action server's result topic
 	ros::Subscriber sub_result_;
+	/// @brief Subscriber of the static map topic (latched)
+	ros::Subscriber sub_map_;
 
 	/// Helper typedefs
 	typedef actionlib::SimpleActionClient<move_base_msgs::MoveBaseAction> MoveBaseActionClient;
@@ -219,6 +361,12 @@ protected:
 	/// @brief Flag that turns true when connection with service server was established
 	bool nav_srv_mb_get_plan_exists_;
 
+	/// @brief Time of the latest check whether the service exists
+	ros::Time nav_srv_check_stamp_;
+
+	/// @brief Flag that turns true when transform from the world frame to the actor base frame was found
+	bool nav_tf_available_;
+
 	/// @brief Stores most recent navigation goal, helps goal restoration
 	move_base_msgs::MoveBaseGoal nav_goal_;
 	/// @}
@@ -238,9 +386,11 @@ protected:
 	 * @defgroup tf Transform frames
 	 * @{
 	 */
-	tf2_ros::Buffer tf_buffer_;
-	tf2_ros::TransformListener tf_listener_;
 	tf2_ros::TransformBroadcaster tf_broadcaster_;
+	/// @brief Process-wide TF listener shared with other actors, also publishes transforms of all actors in batches
+	std::shared_ptr<TransformService> tf_service_ptr_;
+	/// @brief Whether actor transforms are published via @ref tf_service_ptr_ (true) or @ref tf_broadcaster_
+	bool tf_batched_;
 	std::string frame_base_;
 	// NOTE: frame_global_ref_ already defined in the base class
 	std::string frame_local_ref_;
@@ -249,18 +399,110 @@ protected:
 	/// @}
 
 	/**
-	 * @defgroup cmdvel Velocity commands
+	 * @defgroup cmdvel Data handed over from ROS callbacks to the simulation thread without locking
 	 * @{
 	 */
-	Vector3 cmd_vel_;
-	std::mutex mutex_callback_;
+	/// @brief Most recent velocity command, expressed in the actor base frame
+	TripleBuffer<Vector3> cmd_vel_local_;
+	/// @brief Most recent feedback; base class methods set @ref feedback_ that is then published here
+	TripleBuffer<TaskFeedbackType> feedback_latest_;
 	/// @}
 
 	/// @brief Initial pose of the actor - used for 'odometry' calculations
 	Pose3 pose_initial_;
 
+	/**
+	 * @defgroup pubrate Publication rates of the outgoing streams
+	 * @{
+	 */
+	PublicationGovernor odom_governor_;
+	PublicationGovernor tf_governor_;
+	/// @}
+
 	/// @brief Tolerance (in meters) when requesting a path plan to a certain pose
 	double nav_get_plan_tolerance_;
+
+	/**
+	 * @defgroup incrementalplanning Incremental planning on the static map
+	 * @{
+	 */
+	/// @brief How much (in meters) obstacles of the static map are enlarged before planning
+	double planner_inflation_radius_;
+
+	/// @brief Map received in the most recent callback, waiting to be passed to the planner
+	std::shared_ptr<const OccupancyGrid> map_received_ptr_;
+	/// @brief Region graph prepared for the @ref map_received_ptr_
+	std::shared_ptr<const RegionGraphPlanner> region_planner_received_ptr_;
+	/// @brief Roadmap prepared for the @ref map_received_ptr_
+	std::shared_ptr<const Roadmap> roadmap_received_ptr_;
+	mutable std::mutex mutex_map_;
+	/// @brief Inflated maps, region graphs and roadmaps shared by all actors in the process
+	std::shared_ptr<StaticMapCache> static_map_cache_ptr_;
+
+	/// @brief Map that the planner operates on, expressed in the global reference frame
+	std::shared_ptr<const OccupancyGrid> map_ptr_;
+	DStarLite planner_;
+	/// @}
+
+	/**
+	 * @defgroup hierarchicalplanning Two-level planning on the static map (replaces ROS service calls)
+	 * @details Plans are requested only to draw random goals, hence the region graph is used only if the roadmap
+	 * is disabled
+	 * @{
+	 */
+	bool hierarchical_planning_;
+	/// @brief Length (in meters) of the side of the block that the map is divided into
+	double planner_region_size_;
+	std::shared_ptr<const RegionGraphPlanner> region_planner_ptr_;
+	/// @brief State of the queries of the shared @ref region_planner_ptr_
+	RegionGraphPlanner::Query region_query_;
+	/// @}
+
+	/**
+	 * @defgroup roadmap Roadmap of the static map used to draw random goals
+	 * @{
+	 */
+	bool roadmap_enabled_;
+	/// @brief Number of roadmap nodes
+	int roadmap_nodes_;
+	/// @brief Max length (in meters) of the roadmap edge
+	double roadmap_connection_radius_;
+	/// @brief Number of goals sampled in advance, 0 disables prefetching
+	int roadmap_prefetch_goals_;
+	/// @brief Seed of the roadmap node sampler, actors with the same seed share the roadmap of the same map
+	int roadmap_seed_;
+	std::shared_ptr<const Roadmap> roadmap_ptr_;
+	std::mt19937 roadmap_gen_;
+	std::shared_ptr<GoalPrefetcher> goal_prefetcher_ptr_;
+	/// @brief Pose that the goals are prefetched from (the most recently chosen goal)
+	Pose3 goal_prefetch_start_;
+	/// @}
+
+	/**
+	 * @defgroup flowfield Navigation along the flow fields shared among actors (replaces navigation stack)
+	 * @{
+	 */
+	bool flow_field_enabled_;
+	/// @brief Max linear velocity (m/s) commanded during flow field navigation
+	double flow_field_max_vel_lin_;
+	/// @brief Max angular velocity (rad/s) commanded during flow field navigation
+	double flow_field_max_vel_ang_;
+	/// @brief How far (in meters) along the flow field the actor heads to
+	double flow_field_lookahead_;
+	/// @brief Distance (in meters) to the goal that is treated as reached
+	double flow_field_goal_tolerance_;
+
+	/// @brief Flow fields shared by all actors in the process
+	std::shared_ptr<FlowFieldCache> flow_field_cache_ptr_;
+	/// @brief Field of the current goal, valid only when @ref flow_field_active_ is set
+	std::shared_ptr<const FlowField> flow_field_ptr_;
+	/// @brief Goal of the flow field navigation, expressed in the global reference frame
+	Pose3 flow_field_goal_;
+	/// @brief Transform from the world frame to the global reference frame (frame of the map)
+	Pose3 flow_field_transform_;
+	/// @brief Whether velocity commands and feedback come from the flow field instead of the navigation stack
+	std::atomic<bool> flow_field_active_;
+	/// @}
 };
 
 } // namespace hubero
@@ -4,11 +4,18 @@
 
 #include <ros/ros.h>
 #include <hubero_ros/node.h>
+#include <hubero_ros/utils/person_batch.h>
+#include <hubero_ros/utils/publication_governor.h>
+
+#include <memory>
 
 namespace hubero {
 
 /**
  * @brief Implements ROS interface to broadcast HuBeRo Actor's status
+ *
+ * @details Each actor publishes its status on a separate topic. Optionally (see 'status_array/enabled' parameter),
+ * statuses of all actors are also published together, in a single PersonArray message per simulation step.
  */
 class StatusRos: public StatusBase {
 public:
@@ -16,7 +23,7 @@ public:
 	/// Defines default size of the queue used for publisher
 	static const int PUBLISHER_QUEUE_SIZE;
 
-    /// How often publish updated status
+    /// How often publish updated status by default (overridden with 'publication/status/rate' parameter)
     static const ros::Duration UPDATE_PUBLISH_PERIOD;
 
     StatusRos();
@@ -32,12 +39,40 @@ public:
      */
     virtual void update(const Pose3& pose, const Vector3& vel_lin, const Vector3& vel_ang) override;
 
+    /**
+     * @brief Publishes statuses of all actors collected so far; expected to be called once the simulation step ends
+     */
+    static void flush();
+
 protected:
+    /**
+     * @brief Advertises the topic with statuses of all actors, performed once for all instances
+     */
+    static void initializeArray(std::shared_ptr<Node> node_ptr);
+
+    /**
+     * @brief Evaluates governor of the aggregated statuses once per step, i.e., for the first actor with a given stamp
+     */
+    static bool isArrayPublishRequired(const ros::Time& stamp);
+
     /// ROS publisher to broadcast Actor status
     ros::Publisher pub_status_;
 
-    /// Timestamp of last status broadcast (prevents too frequent publishes that are unnecessary)
-    ros::Time time_last_pub_;
+    /// Prevents too frequent publishes that are unnecessary
+    PublicationGovernor pub_governor_;
+
+    /// Whether @ref initializeArray was already called
+    static bool array_initialized_;
+    /// Collects statuses of all actors, nullptr if the aggregated publication is disabled
+    static std::shared_ptr<PersonBatch> array_batch_ptr_;
+    /// ROS publisher to broadcast statuses of all actors
+    static ros::Publisher pub_array_;
+    /// Prevents too frequent publishes of the aggregated statuses
+    static PublicationGovernor pub_array_governor_;
+    /// Stamp of the step that the @ref array_step_publish_ decision refers to
+    static ros::Time array_step_stamp_;
+    /// Whether statuses of the current step should be collected for the aggregated publication
+    static bool array_step_publish_;
 
     /// Handy for counting actors that use this interface
     static int actor_num_;
@@ -3,6 +3,8 @@
 #include <hubero_common/typedefs.h>
 #include <hubero_interfaces/task_request_base.h>
 #include <hubero_ros/node.h>
+#include <hubero_ros/utils/publication_governor.h>
+#include <hubero_ros/utils/transform_service.h>
 
 #include <hubero_ros_msgs/FollowObjectAction.h>
 #include <hubero_ros_msgs/LieDownAction.h>
@@ -10,6 +12,7 @@
 #include <hubero_ros_msgs/MoveAroundAction.h>
 #include <hubero_ros_msgs/MoveToGoalAction.h>
 #include <hubero_ros_msgs/MoveToObjectAction.h>
+#include <hubero_ros_msgs/RequestTasksAction.h>
 #include <hubero_ros_msgs/RunAction.h>
 #include <hubero_ros_msgs/SitDownAction.h>
 #include <hubero_ros_msgs/SitDownObjectAction.h>
@@ -21,14 +24,15 @@
 #include <actionlib/server/simple_action_server.h>
 #include <actionlib_msgs/GoalStatus.h>
 
-#include <tf2_ros/buffer.h>
-#include <tf2_ros/transform_listener.h>
-
 #include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <stdexcept>
 #include <string>
-#include <thread>
+#include <vector>
 
 namespace hubero {
 
@@ -49,17 +53,34 @@ public:
 	/// Contains suffix attached to basic action name, e.g., MoveToGoal vs MoveToObject
 	static const std::string OBJECT_ORIENTED_TASK_SUFFIX;
 
-	/// How often task feedback should be published
+	/**
+	 * @brief Max period between feedback publications (publication may be limited further, see @ref feedback_pub_params_)
+	 * @details Task state changes and action server events are handled immediately, regardless of this period
+	 */
 	static const std::chrono::milliseconds TASK_FEEDBACK_PERIOD;
 
-	/// How many times a pending goal is allowed to be queried (each TASK_FEEDBACK_PERIOD)
-	static const int TASK_PENDING_COUNTER_LIMIT;
+	/// How long a goal is allowed to stay pending
+	static const std::chrono::milliseconds TASK_PENDING_TIMEOUT;
+
+	/// How long to wait for the actor to process an abort of the current goal or a request of the new one
+	static const std::chrono::milliseconds TASK_TRANSITION_TIMEOUT;
+
+	/// Name of the action that requests tasks from multiple actors at once (placed in the task namespace)
+	static const std::string BULK_TASK_REQUEST_NAME;
+
+	/// Max period between feedback publications of the bulk task request
+	static const std::chrono::milliseconds BULK_TASK_FEEDBACK_PERIOD;
 
 	/**
 	 * @brief Default constructor
 	 */
 	TaskRequestRos();
 
+	/**
+	 * @brief Destructor, unregisters the instance from the bulk task request action
+	 */
+	virtual ~TaskRequestRos();
+
 	/**
 	 * @brief Initializes ROS interface to request tasks from simulated actor, named @ref actor_name
 	 * @param world_frame_name ID of the coordinate system that actor operates in (i.e. simulator frame of reference)
@@ -105,17 +126,95 @@ protected:
 	ActionServerPtr<hubero_ros_msgs::TeleopAction> as_teleop_;
 	/// @}
 
+	/**
+	 * @defgroup bulkrequest Requesting tasks from multiple actors at once
+	 * @details Single action server is shared by all actors of the process, they are looked up by name
+	 * @{
+	 */
+	/// Task of the bulk request resolved to the actor's task instance
+	struct BulkTaskEntry {
+		std::string actor_name;
+		std::string task_name;
+		TaskType task_type;
+		std::shared_ptr<TaskBase> task_ptr;
+	};
+
+	static ActionServerPtr<hubero_ros_msgs::RequestTasksAction> as_request_tasks_;
+	/// Instances that initialized ROS interface, indexed with actor names
+	static std::map<std::string, TaskRequestRos*> instances_;
+	/// Guards @ref instances_, @ref request_tasks_notifier_ and requests issued from the bulk action callback
+	static std::mutex instances_mutex_;
+	/// Wakes up the handler of the bulk task request that is currently executed
+	static std::weak_ptr<TaskEventNotifier> request_tasks_notifier_;
+
+	/**
+	 * @brief Handles the goal of the bulk task request
+	 *
+	 * @details Tasks are requested with @ref requestTasks, then statuses of all of them are published as a single
+	 * feedback stream until each task finishes
+	 */
+	static void actionCbRequestTasks(const hubero_ros_msgs::RequestTasksGoalConstPtr& goal);
+
+	/**
+	 * @brief Wakes up the handler of the bulk task request, e.g. once preempt was requested
+	 */
+	static void notifyRequestTasks();
+
+	/**
+	 * @brief Requests @ref tasks from actors, either all of them or none
+	 *
+	 * @details Goal is validated as a whole first (all actors and tasks must be known and each actor may be
+	 * listed once). Then, current goals of the same tasks are aborted and all tasks are requested back-to-back.
+	 * If any request is rejected, tasks requested so far are aborted
+	 *
+	 * @param entries filled with the tasks resolved from @ref tasks; empty if the validation failed
+	 * @param error description of the failure; empty on success
+	 * @return true if all tasks were requested
+	 */
+	static bool requestTasks(
+		const std::vector<hubero_ros_msgs::TaskGoal>& tasks,
+		std::vector<BulkTaskEntry>& entries,
+		std::string& error
+	);
+
+	/**
+	 * @brief Requests task from the actor based on the entry of the bulk task request
+	 * @param goal_world_pose goal pose of the task transformed to the world frame
+	 */
+	bool requestTaskGoal(TaskType task_type, const hubero_ros_msgs::TaskGoal& goal, const Pose3& goal_world_pose);
+
+	/**
+	 * @brief Fills @ref statuses with current feedback types of the tasks listed in @ref entries
+	 * @return true if any of the tasks is still pending or active
+	 */
+	static bool collectTasksStatus(
+		const std::vector<BulkTaskEntry>& entries,
+		std::vector<hubero_ros_msgs::TaskStatus>& statuses
+	);
+
+	/**
+	 * @brief Aborts all tasks listed in @ref entries that are still pending or active
+	 */
+	static void abortTasks(const std::vector<BulkTaskEntry>& entries);
+	/// @}
+
 	/**
 	 * @defgroup tf Frame transformations
 	 * Used for position preparation, we aim core of HuBeRo to operate in simulated world's frame
 	 * @{
 	 */
-	tf2_ros::Buffer tf_buffer_;
-	tf2_ros::TransformListener tf_listener_;
+	/// @brief Process-wide TF listener shared with other actors
+	std::shared_ptr<TransformService> tf_service_ptr_;
 
 	/// @brief Name of the frame that incoming ( @ref update ) poses are referenced in
 	std::string world_frame_name_;
 
+	/**
+	 * @brief Governs publication of the task feedback
+	 * @note actionlib does not expose the number of feedback subscribers, so 'lazy' parameter is ignored
+	 */
+	PublicationGovernor::Parameters feedback_pub_params_;
+
 	/**
 	 * @brief Performs lookup in ROS TF buffer, looking for @ref frame_id -> @ref world_frame_name_ transform
 	 */
@@ -193,38 +292,34 @@ protected:
 			return;
 		}
 
-		// wait until accepted
-		int pending_counter = 0;
-		while (getTaskFeedbackType(task_type) == TASK_FEEDBACK_PENDING) {
-			if (pending_counter++ >= TASK_PENDING_COUNTER_LIMIT) {
-				HUBERO_LOG(
-					"[%s].[TaskRequestRos] Pending status of task (type %d) is staying for too long, aborting task\r\n",
-					actor_name_.c_str(),
-					task_type
-				);
-				as_ptr->setAborted();
-				return;
-			}
-			std::this_thread::sleep_for(TASK_FEEDBACK_PERIOD);
+		// wait until accepted (woken up once the actor changes the task state)
+		if (waitForTaskFeedbackChange(task_type, TASK_FEEDBACK_PENDING, TASK_PENDING_TIMEOUT) == TASK_FEEDBACK_PENDING) {
+			HUBERO_LOG(
+				"[%s].[TaskRequestRos] Pending status of task (type %d) is staying for too long, aborting task\r\n",
+				actor_name_.c_str(),
+				task_type
+			);
+			as_ptr->setAborted();
+			return;
 		}
 
 		// activated
+		PublicationGovernor feedback_governor(feedback_pub_params_);
 		TaskFeedbackType feedback_type = TASK_FEEDBACK_UNDEFINED;
+		// events are counted before the conditions are checked, so none occurring in the meantime is missed
+		uint64_t event = getTaskFeedbackEvent(task_type);
 		while ((feedback_type = getTaskFeedbackType(task_type)) == TASK_FEEDBACK_ACTIVE) {
-			Tfeedback feedback;
-			feedback.feedback.status = feedback_type;
-			as_ptr->publishFeedback(feedback);
+			if (feedback_governor.isPublishRequired(ros::Time::now())) {
+				Tfeedback feedback;
+				feedback.feedback.status = feedback_type;
+				as_ptr->publishFeedback(feedback);
+			}
 
 			// check if new goal was selected and execute procedure after new goal received (once)
 			if (as_ptr->isNewGoalAvailable()) {
-				// make sure that current goal is aborted
+				// make sure that current goal is aborted and wait until the actor's FSM processes the abort
 				abort(task_type);
-				/*
-				 * NOTE: this sleep must be longer than Actor class update period (FSM must be updated to catch
-				 * the trigger of abort->request->activation)
-				 * // FIXME: work out a cleaner/nicer solution
-				 */
-				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				waitForTaskFeedbackChange(task_type, TASK_FEEDBACK_ABORTED, TASK_TRANSITION_TIMEOUT);
 
 				auto goal = as_ptr->acceptNewGoal();
 				bool new_request_ok = requestActionGoal(goal);
@@ -238,8 +333,11 @@ protected:
 						"[%s].[TaskRequestRos] New goal requested successfully\r\n",
 						actor_name_.c_str()
 					);
-					std::this_thread::sleep_for(TASK_FEEDBACK_PERIOD);
-					auto feedback_new_request = getTaskFeedbackType(task_type);
+					auto feedback_new_request = waitForTaskFeedbackChange(
+						task_type,
+						TASK_FEEDBACK_PENDING,
+						TASK_TRANSITION_TIMEOUT
+					);
 					if (feedback_new_request != TASK_FEEDBACK_ACTIVE && feedback_new_request != TASK_FEEDBACK_PENDING) {
 						// invalid feedback state, aborting HuBeRo task and action server
 						HUBERO_LOG(
@@ -275,7 +373,9 @@ protected:
 					task_type
 				);
 			}
-			std::this_thread::sleep_for(TASK_FEEDBACK_PERIOD);
+			// woken up by the task state change, new goal or preempt request
+			waitForTaskFeedbackEvent(task_type, event, TASK_FEEDBACK_PERIOD);
+			event = getTaskFeedbackEvent(task_type);
 		}
 
 		auto final_feedback_type = getTaskFeedbackType(task_type);
@@ -20,7 +20,12 @@
 #include <hubero_ros_msgs/TalkObjectAction.h>
 #include <hubero_ros_msgs/TeleopAction.h>
 
+#include <atomic>
+#include <functional>
+#include <future>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace hubero {
 
@@ -33,12 +38,51 @@ namespace hubero {
  */
 class TaskRequestRosApi {
 public:
+	/// Period of checking whether action servers came up
+	static const double CONNECTION_CHECK_PERIOD;
+	/// Period of logging the action servers that are still not connected
+	static const double CONNECTION_LOG_PERIOD;
+
 	/**
 	 * @brief Constructor of @ref TaskRequestRosApi instance
+	 *
+	 * @details Does not block - all action clients connect concurrently in the background. Use @ref getReadyFuture
+	 * or @ref waitForReady to synchronize with the connection; task requests wait for it implicitly.
+	 *
 	 * @param actor_name actor identifier from simulation
 	 */
 	TaskRequestRosApi(const std::string& actor_name);
 
+	/**
+	 * @brief Stops the background connection (if still in progress)
+	 */
+	virtual ~TaskRequestRosApi();
+
+	/**
+	 * @brief Returns future that becomes ready once all action servers are connected
+	 *
+	 * @details Holds false if ROS was shut down (or the instance was destroyed) before all servers came up.
+	 * The future must not outlive this instance.
+	 */
+	inline std::shared_future<bool> getReadyFuture() const {
+		return ready_future_;
+	}
+
+	/**
+	 * @brief Blocks until all action servers are connected
+	 *
+	 * @param timeout maximum waiting time in seconds, negative value means no limit
+	 * @return true if all action servers are connected
+	 */
+	bool waitForReady(double timeout = -1.0) const;
+
+	/**
+	 * @brief Returns true if all action servers are connected (non-blocking)
+	 */
+	inline bool isReady() const {
+		return waitForReady(0.0);
+	}
+
 	/**
 	 * @defgroup tasks Methods that allow to request specific task from controlled actor
 	 * @{
@@ -457,7 +501,7 @@ protected:
 	 */
 	template <typename Tacptr, typename Tgoal>
 	bool sendActionGoal(Tacptr& action_client_ptr, const Tgoal& action_goal) {
-		if (action_client_ptr == nullptr) {
+		if (action_client_ptr == nullptr || !waitForReady()) {
 			return false;
 		}
 		action_client_ptr->sendGoal(action_goal);
@@ -469,7 +513,7 @@ protected:
 	 */
 	template <typename Tacptr>
 	bool cancelActionGoals(Tacptr& action_client_ptr) {
-		if (action_client_ptr == nullptr) {
+		if (action_client_ptr == nullptr || !waitForReady()) {
 			return false;
 		}
 		action_client_ptr->cancelAllGoals();
@@ -498,9 +542,35 @@ protected:
 		return action_client_ptr->getFeedbackText();
 	}
 
+	/**
+	 * @brief Adds action client to the set of clients awaited in @ref connect
+	 */
+	template <typename Tacptr>
+	void addConnection(const Tacptr& action_client_ptr) {
+		connections_.push_back(std::make_pair(
+			action_client_ptr->getActionNamespace(),
+			[action_client_ptr]() { return action_client_ptr->isServerConnected(); }
+		));
+	}
+
+	/**
+	 * @brief Waits until all action servers are connected; executed in a separate thread
+	 *
+	 * @details Clients connect independently of each other, so the total waiting time equals
+	 * the time of the slowest connection
+	 */
+	bool connect();
+
 private:
 	/// Name of the actor provided in the constructor
 	std::string actor_name_;
 
+	/// Action namespaces along with the connection state checkers of their clients
+	std::vector<std::pair<std::string, std::function<bool()>>> connections_;
+	/// Set in the destructor to stop the background connection
+	std::atomic<bool> connection_aborted_;
+	/// Result of @ref connect; declared last, so it is destroyed (and joined) before the clients
+	std::shared_future<bool> ready_future_;
+
 }; // class TaskRequestRosApi
 } // namespace hubero
@@ -51,23 +51,40 @@ public:
 			&ActionClient::callbackResult, this
 		);
 		feedback_status_ = TaskFeedbackType::TASK_FEEDBACK_UNDEFINED;
+		action_task_ns_ = action_task_ns;
+	}
 
+	/**
+	 * @brief Blocks until the action server becomes online
+	 *
+	 * @details Constructor does not wait for the server, so multiple clients may connect concurrently
+	 * (each one spins its own callback queue). Use this method if a single client is operated.
+	 *
+	 * @return false if ROS was shut down before the server came up
+	 */
+	bool waitForConnection() {
 		if (!ros::ok()) {
-			ROS_ERROR("%s: Action server has not been started correctly (ROS is not running)", action_task_ns.c_str());
-			return;
+			ROS_ERROR("%s: Action server has not been started correctly (ROS is not running)", action_task_ns_.c_str());
+			return false;
 		}
 
 		// Wait for server to become online
 		while (!this->waitForServer(ros::Duration(5.0))) {
-			ROS_INFO("%s: Waiting for the action server to come up: ", action_task_ns.c_str());
+			ROS_INFO("%s: Waiting for the action server to come up: ", action_task_ns_.c_str());
 			// check if waitingForServer has been terminated by the process finish
 			if (!ros::ok()) {
-				ROS_ERROR("%s: Action server has not been started correctly", action_task_ns.c_str());
-				return;
+				ROS_ERROR("%s: Action server has not been started correctly", action_task_ns_.c_str());
+				return false;
 			}
 		}
 
-		ROS_INFO("%s: Action server started!", action_task_ns.c_str());
+		ROS_INFO("%s: Action server started!", action_task_ns_.c_str());
+		return true;
+	}
+
+	/// @brief Returns namespace of the action-related ROS topics
+	inline std::string getActionNamespace() const {
+		return action_task_ns_;
 	}
 
 	/**
@@ -98,6 +115,7 @@ protected:
 
 	ros::Subscriber sub_feedback_;
 	ros::Subscriber sub_result_;
+	std::string action_task_ns_;
 	TaskFeedbackType feedback_status_;
 	std::string feedback_txt_;
 }; // class ActionClient
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <hubero_ros/utils/step_batch.h>
+
+#include <hubero_ros_msgs/Person.h>
+#include <hubero_ros_msgs/PersonArray.h>
+
+namespace hubero {
+
+/**
+ * @brief Statuses of a single step are published in one PersonArray sharing the header of its people;
+ * each actor may appear once
+ */
+template <>
+struct StepBatchTraits<hubero_ros_msgs::PersonArray> {
+	typedef hubero_ros_msgs::Person Item;
+
+	static std::vector<Item>& items(hubero_ros_msgs::PersonArray& msg) {
+		return msg.people;
+	}
+
+	static const std::string& key(const Item& item) {
+		return item.object_id;
+	}
+
+	static bool isSameStep(const hubero_ros_msgs::PersonArray& batch, const Item& item) {
+		return batch.header.stamp == item.header.stamp && batch.header.frame_id == item.header.frame_id;
+	}
+
+	static void initialize(hubero_ros_msgs::PersonArray& batch, const Item& item) {
+		batch.header.stamp = item.header.stamp;
+		batch.header.frame_id = item.header.frame_id;
+	}
+};
+
+/// @brief Collects statuses of all actors produced during a single simulation step into one PersonArray message
+typedef StepBatch<hubero_ros_msgs::PersonArray> PersonBatch;
+
+} // namespace hubero
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <ros/ros.h>
+
+#include <string>
+
+namespace hubero {
+
+/**
+ * @brief Decides whether a sample of an outgoing data stream should be published
+ *
+ * @details Limits publication rate, decimates samples and (optionally) skips publication when nobody listens.
+ * Each stream is governed by a separate instance so fidelity can be traded for throughput per deployment.
+ */
+class PublicationGovernor {
+public:
+	struct Parameters {
+		/// Max publication rate (Hz); non-positive value does not limit the rate
+		double rate;
+		/// Only each N-th sample is considered for publication (then the rate limit applies); 1 considers each sample
+		int decimation;
+		/// Whether publication is skipped when the stream has no subscribers
+		bool lazy;
+
+		Parameters(double rate_max = 0.0, int decimation_factor = 1, bool lazy_publication = true):
+			rate(rate_max),
+			decimation(decimation_factor),
+			lazy(lazy_publication)
+		{}
+	};
+
+	PublicationGovernor(const Parameters& params = Parameters());
+
+	/**
+	 * @brief Reads parameters of the stream from the Parameter Server
+	 *
+	 * @param param_ns namespace of the stream parameters, e.g. "/hubero_ros/actor1/publication/odometry";
+	 * it is expected to contain "rate", "decimation" and "lazy" keys
+	 * @param params_default values used when keys are not found
+	 */
+	static Parameters loadParameters(const std::string& param_ns, const Parameters& params_default);
+
+	void setParameters(const Parameters& params);
+
+	inline Parameters getParameters() const {
+		return params_;
+	}
+
+	/**
+	 * @brief Evaluates whether the sample at @ref stamp should be published
+	 *
+	 * @details Sample evaluated positively is assumed to be published
+	 *
+	 * @param subscribers_num number of subscribers of the stream, see ros::Publisher::getNumSubscribers
+	 */
+	bool isPublishRequired(const ros::Time& stamp, uint32_t subscribers_num = 1);
+
+	/**
+	 * @brief Forgets the last publication, so the next sample (with subscribers) will be published
+	 */
+	void reset();
+
+protected:
+	Parameters params_;
+	ros::Duration period_;
+
+	bool published_;
+	ros::Time stamp_last_;
+	/// @brief Number of samples that were rejected since the last publication
+	int samples_skipped_;
+}; // class PublicationGovernor
+
+} // namespace hubero
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <ros/ros.h>
+
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Describes how items are stored in the message aggregated by @ref StepBatch
+ *
+ * @details Specialization must define:
+ * - @c Item - type of a single entry of the message
+ * - @c static std::vector<Item>& items(Tmsg& msg) - access to the entries of the message
+ * - @c static const std::string& key(const Item& item) - identifier that is expected to be unique within a step
+ * - @c static bool isSameStep(const Tmsg& batch, const Item& item) - whether @c item may join the non-empty batch
+ * - @c static void initialize(Tmsg& batch, const Item& item) - prepares an empty batch for the first @c item
+ */
+template <typename Tmsg>
+struct StepBatchTraits;
+
+/**
+ * @brief Collects data produced by all actors during a single simulation step into one message
+ *
+ * @details Actors are updated one after another within a simulation step and all of them stamp their data
+ * with the same time. The batch is expected to be published with @ref flush once the step ends. As a fallback
+ * (e.g., no one flushes), it is also handed over to the publishing callback once an item from another step
+ * arrives (see @ref StepBatchTraits::isSameStep) or once any key is about to be added again (next step with
+ * the same stamp, e.g. because of a coarse clock).
+ */
+template <typename Tmsg>
+class StepBatch {
+public:
+	typedef StepBatchTraits<Tmsg> Traits;
+	typedef typename Traits::Item Item;
+	typedef std::function<void(const Tmsg&)> PublishFun;
+
+	StepBatch(PublishFun publish_fun = PublishFun()): publish_fun_(publish_fun) {}
+
+	void setPublishCallback(PublishFun publish_fun) {
+		const std::lock_guard<std::mutex> lock(mutex_);
+		publish_fun_ = publish_fun;
+	}
+
+	/**
+	 * @brief Adds item to the batch, publishes the previous batch if a new step started
+	 */
+	void add(const Item& item) {
+		const std::lock_guard<std::mutex> lock(mutex_);
+		addUnsafe(item);
+	}
+
+	/**
+	 * @brief Adds items to the batch, publishes the previous batch if a new step started
+	 */
+	void add(const std::vector<Item>& items) {
+		const std::lock_guard<std::mutex> lock(mutex_);
+		for (const auto& item: items) {
+			addUnsafe(item);
+		}
+	}
+
+	/**
+	 * @brief Publishes items collected so far (if any)
+	 */
+	void flush() {
+		const std::lock_guard<std::mutex> lock(mutex_);
+		flushUnsafe();
+	}
+
+	/// @brief Returns number of items waiting for publication
+	size_t getSize() const {
+		const std::lock_guard<std::mutex> lock(mutex_);
+		// keys are unique within the batch
+		return batch_keys_.size();
+	}
+
+protected:
+	/// @brief Adds item to the batch, must be called with @ref mutex_ locked
+	void addUnsafe(const Item& item) {
+		auto& items = Traits::items(batch_);
+		if (!items.empty()) {
+			bool new_step = !Traits::isSameStep(batch_, item);
+			bool key_repeated = batch_keys_.find(Traits::key(item)) != batch_keys_.end();
+			if (new_step || key_repeated) {
+				flushUnsafe();
+			}
+		}
+		if (items.empty()) {
+			Traits::initialize(batch_, item);
+		}
+		batch_keys_.insert(Traits::key(item));
+		items.push_back(item);
+	}
+
+	/// @brief Publishes the batch, must be called with @ref mutex_ locked
+	void flushUnsafe() {
+		auto& items = Traits::items(batch_);
+		if (items.empty()) {
+			return;
+		}
+		if (publish_fun_) {
+			publish_fun_(batch_);
+		}
+		items.clear();
+		batch_keys_.clear();
+	}
+
+	PublishFun publish_fun_;
+
+	Tmsg batch_;
+	/// @brief Keys of the items that are already present in the @ref batch_
+	std::set<std::string> batch_keys_;
+	mutable std::mutex mutex_;
+}; // class StepBatch
+
+} // namespace hubero
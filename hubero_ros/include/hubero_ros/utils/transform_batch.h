@@ -0,0 +1,35 @@
+#pragma once
+
+#include <hubero_ros/utils/step_batch.h>
+
+#include <geometry_msgs/TransformStamped.h>
+#include <tf2_msgs/TFMessage.h>
+
+namespace hubero {
+
+/**
+ * @brief Transforms of a single step are published in one TF message; each child frame may appear once
+ */
+template <>
+struct StepBatchTraits<tf2_msgs::TFMessage> {
+	typedef geometry_msgs::TransformStamped Item;
+
+	static std::vector<Item>& items(tf2_msgs::TFMessage& msg) {
+		return msg.transforms;
+	}
+
+	static const std::string& key(const Item& item) {
+		return item.child_frame_id;
+	}
+
+	static bool isSameStep(const tf2_msgs::TFMessage& batch, const Item& item) {
+		return batch.transforms.front().header.stamp == item.header.stamp;
+	}
+
+	static void initialize(tf2_msgs::TFMessage& /*batch*/, const Item& /*item*/) {}
+};
+
+/// @brief Collects transforms produced by all actors during a single simulation step into one TF message
+typedef StepBatch<tf2_msgs::TFMessage> TransformBatch;
+
+} // namespace hubero
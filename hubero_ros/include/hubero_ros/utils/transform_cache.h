@@ -0,0 +1,120 @@
+#pragma once
+
+#include <hubero_common/typedefs.h>
+
+#include <ros/ros.h>
+#include <tf2_msgs/TFMessage.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Caches transforms between frames that are connected with a chain of static transforms only
+ *
+ * @details Tracks edges of the TF tree received via `/tf` and `/tf_static` (messages are passed with @ref update
+ * by the owner of the subscriptions, see @ref TransformService). An edge is static if it was published
+ * on `/tf_static` or if it never changed its value since it was received for the first time (e.g., one published
+ * periodically by the `tf/static_transform_publisher`). Transforms resolved from static chains are stored
+ * in an immutable snapshot, so queries from the hot path do not lock anything. Once any of the static edges
+ * changes, only transforms resolved through that edge are dropped from the snapshot and resolved again on demand.
+ *
+ * @details Queries about chains that contain dynamic edges fail - these must be handled by the tf2 buffer.
+ */
+class TransformCache {
+public:
+	/**
+	 * @brief Maximum number of edges between the frame and the root of the TF tree (protects against loops)
+	 */
+	static const int CHAIN_LENGTH_MAX;
+
+	TransformCache();
+
+	/**
+	 * @brief Updates edges of the TF tree with all transforms from the message
+	 *
+	 * @param is_static true if message comes from the `/tf_static` topic
+	 */
+	void update(const tf2_msgs::TFMessage& msg, bool is_static);
+
+	/**
+	 * @brief Finds transform between frames if they are connected with a static chain
+	 *
+	 * @param transform transform that satisfies `pose_target = pose_source + transform`
+	 * (same convention as `lookupTransform(frame_target, frame_source)`)
+	 * @return true if transform is valid; false when frames are unknown or connected via dynamic edges
+	 */
+	bool find(const std::string& frame_source, const std::string& frame_target, Pose3& transform);
+
+	/**
+	 * @brief Updates the edge of the TF tree
+	 *
+	 * @param transform pose of the child frame expressed in the parent frame
+	 * @param is_static true if transform comes from the `/tf_static` topic
+	 * @param stamp timestamp of the transform; transforms older than the stored one are ignored
+	 */
+	void updateEdge(
+		const std::string& frame_parent,
+		const std::string& frame_child,
+		const Pose3& transform,
+		bool is_static,
+		const ros::Time& stamp = ros::Time()
+	);
+
+	/// @brief Returns number of transforms stored in the current snapshot
+	size_t getCachedNum() const;
+
+protected:
+	/// @brief Transform of the child frame relative to its parent
+	struct Edge {
+		std::string parent;
+		Pose3 transform;
+		ros::Time stamp;
+		/// True once transform changed its value over time
+		bool dynamic;
+	};
+
+	/// @brief Transform resolved from a static chain
+	struct Resolved {
+		Pose3 transform;
+		/// Child frames of the edges that form the chain
+		std::vector<std::string> edges;
+	};
+
+	typedef std::pair<std::string, std::string> FramePair;
+	typedef std::map<FramePair, Resolved> Snapshot;
+
+	/**
+	 * @brief Collects ancestors of the frame (starting from the frame itself) with transforms from the frame
+	 * to each ancestor
+	 *
+	 * @details Traversal stops at the first dynamic edge
+	 */
+	std::vector<std::pair<std::string, Pose3>> collectStaticAncestors(const std::string& frame) const;
+
+	/**
+	 * @brief Drops transforms resolved through the edge of the given child frame from the snapshot
+	 * @note Must be called with @ref mutex_ locked
+	 */
+	void invalidateEdge(const std::string& frame_child);
+
+	/// @brief Removes leading slash, tf2 does the same
+	static std::string stripSlash(const std::string& frame);
+
+	/// @brief Returns true if transforms differ
+	static bool isDifferent(const Pose3& a, const Pose3& b);
+
+	/// @brief Edges indexed with child frame names; access guarded by @ref mutex_
+	std::map<std::string, Edge> edges_;
+	std::mutex mutex_;
+
+	/// @brief Resolved transforms; replaced as a whole (accessed with atomic_load/atomic_store only)
+	std::shared_ptr<const Snapshot> snapshot_ptr_;
+}; // class TransformCache
+
+} // namespace hubero
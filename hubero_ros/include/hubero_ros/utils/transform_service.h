@@ -0,0 +1,108 @@
+#pragma once
+
+#include <hubero_common/typedefs.h>
+#include <hubero_ros/utils/transform_batch.h>
+#include <hubero_ros/utils/transform_cache.h>
+
+#include <ros/ros.h>
+#include <ros/callback_queue.h>
+#include <tf2_ros/buffer.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hubero {
+
+/**
+ * @brief Process-wide source of transforms between TF frames
+ *
+ * @details Owns a single tf2 buffer and @ref TransformCache that are shared by all actors simulated in the process.
+ * TF topics are subscribed once (instead of using tf2_ros::TransformListener) and each received message
+ * feeds both the buffer and the cache, so the TF tree is received and deserialized only once regardless
+ * of the number of actors. Transforms broadcasted by actors are also published in batches, one TF message per
+ * simulation step for all actors. Similarly to @ref Node, the first instance starts the shared resources
+ * and the following ones only refer to them.
+ */
+class TransformService {
+public:
+	/**
+	 * @brief Constructor that starts shared TF listener (once per process)
+	 *
+	 * @param nh_ptr NodeHandle used to subscribe TF topics
+	 */
+	TransformService(std::shared_ptr<ros::NodeHandle> nh_ptr);
+
+	/**
+	 * @brief Finds transform between frames
+	 *
+	 * @details Transforms between frames connected with static chains are served from the @ref TransformCache,
+	 * other ones are looked up in the shared tf2 buffer (the newest available)
+	 *
+	 * @param transform transform that satisfies `pose_target = pose_source + transform`
+	 * @param error description of the failure reason, left untouched on success
+	 * @return true if transform is valid
+	 */
+	bool findTransform(
+		const std::string& frame_source,
+		const std::string& frame_target,
+		Pose3& transform,
+		std::string& error
+	) const;
+
+	/**
+	 * @brief Queues transforms for publication in a TF message shared with other actors
+	 *
+	 * @details See @ref TransformBatch for details on when the message is published
+	 */
+	void sendTransforms(const std::vector<geometry_msgs::TransformStamped>& transforms);
+
+	/**
+	 * @brief Publishes transforms queued by all actors so far; expected to be called once the simulation step ends
+	 */
+	static void flush();
+
+	/**
+	 * @brief Copy a shared_ptr instance of the tf2 buffer for use by other class
+	 */
+	static inline std::shared_ptr<tf2_ros::Buffer> getBufferPtr() {
+		return TransformService::buffer_ptr_;
+	}
+
+protected:
+	/**
+	 * @defgroup tfcallbacks Callbacks of TF topics
+	 * @details Publisher name is used as the authority of the transform, like tf2_ros::TransformListener does
+	 * @{
+	 */
+	static void callbackTf(const ros::MessageEvent<tf2_msgs::TFMessage const>& event);
+	static void callbackTfStatic(const ros::MessageEvent<tf2_msgs::TFMessage const>& event);
+	/// @}
+
+	/**
+	 * @brief Passes transforms from the message to the tf2 buffer and the @ref TransformCache
+	 */
+	static void processMessage(const ros::MessageEvent<tf2_msgs::TFMessage const>& event, bool is_static);
+
+	/**
+	 * @brief Flag to indicate whether the shared listener was started
+	 * @note Prevents creating separate TF listener for each Actor class object
+	 */
+	static bool service_started_;
+
+	/// @brief Guards starting of the shared resources as actors may be initialized concurrently
+	static std::mutex mutex_;
+
+	static std::shared_ptr<tf2_ros::Buffer> buffer_ptr_;
+	/// @brief TF callbacks are processed in a separate thread, regardless of the spinning of the global queue
+	static std::shared_ptr<ros::CallbackQueue> queue_ptr_;
+	static std::shared_ptr<ros::AsyncSpinner> spinner_ptr_;
+	static ros::Subscriber sub_tf_;
+	static ros::Subscriber sub_tf_static_;
+	static std::shared_ptr<TransformCache> cache_ptr_;
+	static std::shared_ptr<TransformBatch> batch_ptr_;
+	static ros::Publisher pub_tf_;
+}; // class TransformService
+
+} // namespace hubero
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace hubero {
+
+/**
+ * @brief Hands the most recent value over from producer threads (e.g., ROS callbacks) to a single consumer
+ * thread (e.g., the simulation thread)
+ *
+ * @details Implements the triple buffer: the producer fills a private slot and swaps it with the shared
+ * "middle" slot in a single atomic operation, the consumer swaps its private slot with the middle one
+ * once it contains a fresh value. The consumer never blocks and always observes a complete value (no tearing);
+ * intermediate values written between two reads are skipped. Producers are serialized with a mutex,
+ * so the values may come from multiple threads, while @ref read must be called from one thread only.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+	explicit TripleBuffer(const T& value = T()):
+		slots_{value, value, value},
+		back_(0),
+		middle_(1),
+		front_(2)
+	{}
+
+	/**
+	 * @brief Publishes the value, overwrites the one that was not read yet (if any)
+	 */
+	void write(const T& value) {
+		std::lock_guard<std::mutex> lock(mutex_write_);
+		slots_[back_] = value;
+		back_ = middle_.exchange(back_ | FLAG_FRESH, std::memory_order_acq_rel) & MASK_INDEX;
+	}
+
+	/**
+	 * @brief Returns the most recently published value; lock-free, must be called from a single thread only
+	 */
+	T read() const {
+		if (middle_.load(std::memory_order_relaxed) & FLAG_FRESH) {
+			front_ = middle_.exchange(front_, std::memory_order_acq_rel) & MASK_INDEX;
+		}
+		return slots_[front_];
+	}
+
+	/**
+	 * @brief Returns true if a value was published since the latest @ref read
+	 */
+	bool isFresh() const {
+		return middle_.load(std::memory_order_acquire) & FLAG_FRESH;
+	}
+
+protected:
+	/// Marks the middle slot that contains a value not read yet
+	static constexpr uint8_t FLAG_FRESH = 0x04;
+	static constexpr uint8_t MASK_INDEX = 0x03;
+
+	T slots_[3];
+	/// Index of the slot owned by the producers
+	uint8_t back_;
+	/// Index of the shared slot with the @ref FLAG_FRESH
+	mutable std::atomic<uint8_t> middle_;
+	/// Index of the slot owned by the consumer
+	mutable uint8_t front_;
+	std::mutex mutex_write_;
+}; // class TripleBuffer
+
+template <typename T>
+constexpr uint8_t TripleBuffer<T>::FLAG_FRESH;
+
+template <typename T>
+constexpr uint8_t TripleBuffer<T>::MASK_INDEX;
+
+} // namespace hubero
@@ -0,0 +1,131 @@
+#include <hubero_ros/bulk_task_request_ros_api.h>
+#include <hubero_ros/task_request_ros.h>
+#include <hubero_ros/utils/converter.h>
+
+#include <algorithm>
+
+namespace hubero {
+
+BulkTaskRequestRosApi::BulkTaskRequestRosApi():
+	node_ptr_(std::make_shared<Node>("task_request_ros_api_node"))
+{
+	// bulk task request action is shared by all actors
+	std::string request_tasks_ns =
+		"/"
+		+ node_ptr_->getNamespaceName()
+		+ "/" + node_ptr_->getTaskNamespaceName()
+		+ "/" + TaskRequestRos::BULK_TASK_REQUEST_NAME;
+	ac_request_tasks_ptr_ = std::make_shared<ActionClient>(request_tasks_ns, true);
+}
+
+bool BulkTaskRequestRosApi::waitForReady(double timeout) const {
+	if (timeout == 0.0) {
+		return ac_request_tasks_ptr_->isServerConnected();
+	}
+	// zero duration means no limit
+	return ac_request_tasks_ptr_->waitForServer(ros::Duration(std::max(timeout, 0.0)));
+}
+
+hubero_ros_msgs::TaskGoal BulkTaskRequestRosApi::createTaskGoal(
+	const std::string& actor_name,
+	TaskType task_type,
+	const Vector3& pos,
+	const double& yaw,
+	const std::string& frame_id,
+	const std::string& object_name
+) {
+	hubero_ros_msgs::TaskGoal task;
+	task.actor_name = actor_name;
+	task.task_name = TaskRequestBase::getTaskName(task_type);
+	task.frame = frame_id;
+	task.pos = ignVectorToMsgPoint(pos);
+	task.yaw = yaw;
+	task.object_name = object_name;
+	return task;
+}
+
+bool BulkTaskRequestRosApi::requestTasks(const std::vector<hubero_ros_msgs::TaskGoal>& tasks) {
+	if (!waitForReady()) {
+		return false;
+	}
+
+	hubero_ros_msgs::RequestTasksGoal action_goal;
+	action_goal.tasks = tasks;
+	{
+		// statuses of the previous request are discarded
+		std::lock_guard<std::mutex> lock(tasks_mutex_);
+		tasks_status_.clear();
+		for (const auto& task: tasks) {
+			hubero_ros_msgs::TaskStatus status;
+			status.actor_name = task.actor_name;
+			status.task_name = task.task_name;
+			status.status = TASK_FEEDBACK_PENDING;
+			tasks_status_.push_back(status);
+		}
+		tasks_state_txt_.clear();
+	}
+	ac_request_tasks_ptr_->sendGoal(
+		action_goal,
+		std::bind(&BulkTaskRequestRosApi::callbackTasksDone, this, std::placeholders::_1, std::placeholders::_2),
+		ActionClient::SimpleActiveCallback(),
+		std::bind(&BulkTaskRequestRosApi::callbackTasksFeedback, this, std::placeholders::_1)
+	);
+	return true;
+}
+
+bool BulkTaskRequestRosApi::cancelTasks() {
+	if (!waitForReady()) {
+		return false;
+	}
+	ac_request_tasks_ptr_->cancelAllGoals();
+	return true;
+}
+
+bool BulkTaskRequestRosApi::waitForTasks(double timeout) {
+	return ac_request_tasks_ptr_->waitForResult(ros::Duration(std::max(timeout, 0.0)));
+}
+
+std::vector<hubero_ros_msgs::TaskStatus> BulkTaskRequestRosApi::getTasksStatus() const {
+	std::lock_guard<std::mutex> lock(tasks_mutex_);
+	return tasks_status_;
+}
+
+TaskFeedbackType BulkTaskRequestRosApi::getTaskState(const std::string& actor_name) const {
+	std::lock_guard<std::mutex> lock(tasks_mutex_);
+	for (const auto& status: tasks_status_) {
+		if (status.actor_name == actor_name) {
+			return static_cast<TaskFeedbackType>(status.status);
+		}
+	}
+	return TASK_FEEDBACK_UNDEFINED;
+}
+
+std::string BulkTaskRequestRosApi::getTasksStateDescription() const {
+	std::lock_guard<std::mutex> lock(tasks_mutex_);
+	return tasks_state_txt_;
+}
+
+void BulkTaskRequestRosApi::callbackTasksFeedback(const hubero_ros_msgs::RequestTasksFeedbackConstPtr& feedback) {
+	std::lock_guard<std::mutex> lock(tasks_mutex_);
+	tasks_status_ = feedback->statuses;
+}
+
+void BulkTaskRequestRosApi::callbackTasksDone(
+	const actionlib::SimpleClientGoalState& state,
+	const hubero_ros_msgs::RequestTasksResultConstPtr& result
+) {
+	std::lock_guard<std::mutex> lock(tasks_mutex_);
+	tasks_state_txt_ = state.toString();
+	if (result == nullptr) {
+		return;
+	}
+	// result of the goal without any task does not contain statuses
+	if (!result->statuses.empty()) {
+		tasks_status_ = result->statuses;
+	}
+	if (!result->text.empty()) {
+		tasks_state_txt_ += ": " + result->text;
+	}
+}
+
+} // namespace hubero
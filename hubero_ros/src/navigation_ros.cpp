@@ -7,6 +7,8 @@
 #include <actionlib_msgs/GoalID.h>
 #include <move_base_msgs/MoveBaseActionGoal.h>
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <thread>
 
@@ -15,16 +17,37 @@ namespace hubero {
 const int NavigationRos::SUBSCRIBER_QUEUE_SIZE = 10;
 const int NavigationRos::PUBLISHER_QUEUE_SIZE = 15;
 const int NavigationRos::QUATERNION_RANDOM_RETRY_NUM = 10;
+const double NavigationRos::PLANNER_REROOT_DISTANCE = 2.0;
+const double NavigationRos::FLOW_FIELD_HEADING_GAIN = 2.0;
+const double NavigationRos::SERVICE_CHECK_PERIOD = 0.5;
 
 NavigationRos::NavigationRos():
 	NavigationBase::NavigationBase(),
 	nav_action_server_connected_(false),
 	nav_srv_mb_get_plan_exists_(false),
+	nav_tf_available_(false),
 	map_x_min_(0.0),
 	map_x_max_(0.0),
 	map_y_min_(0.0),
 	map_y_max_(0.0),
-	tf_listener_(tf_buffer_) {}
+	tf_batched_(true),
+	feedback_latest_(TaskFeedbackType::TASK_FEEDBACK_UNDEFINED),
+	nav_get_plan_tolerance_(1.0),
+	planner_inflation_radius_(0.3),
+	hierarchical_planning_(true),
+	planner_region_size_(3.2),
+	roadmap_enabled_(true),
+	roadmap_nodes_(500),
+	roadmap_connection_radius_(3.0),
+	roadmap_prefetch_goals_(3),
+	roadmap_seed_(0),
+	roadmap_gen_(std::random_device{}()),
+	flow_field_enabled_(false),
+	flow_field_max_vel_lin_(0.5),
+	flow_field_max_vel_ang_(1.0),
+	flow_field_lookahead_(0.5),
+	flow_field_goal_tolerance_(0.2),
+	flow_field_active_(false) {}
 
 bool NavigationRos::initialize(
 	std::shared_ptr<Node> node_ptr,
@@ -102,12 +125,94 @@ bool NavigationRos::initialize(
 	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/result_topic", topic_nav_result);
 	nh.param(topic_nav_result, topic_nav_result, std::string("nav/result"));
 
+	std::string topic_map;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/map_topic", topic_map);
+	nh.param(topic_map, topic_map, std::string("/map"));
+
 	// nav config
 	std::string param_nav_get_plan_tolerance;
 	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/nav_get_plan_tolerance", param_nav_get_plan_tolerance);
 	nh.param(param_nav_get_plan_tolerance, nav_get_plan_tolerance_, 1.0);
 
+	std::string param_planner_inflation_radius;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/planner_inflation_radius", param_planner_inflation_radius);
+	nh.param(param_planner_inflation_radius, planner_inflation_radius_, 0.3);
+
+	std::string param_hierarchical_planning;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/hierarchical_planning", param_hierarchical_planning);
+	nh.param(param_hierarchical_planning, hierarchical_planning_, true);
+
+	std::string param_planner_region_size;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/planner_region_size", param_planner_region_size);
+	nh.param(param_planner_region_size, planner_region_size_, 3.2);
+
+	std::string param_roadmap_enabled;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/roadmap/enabled", param_roadmap_enabled);
+	nh.param(param_roadmap_enabled, roadmap_enabled_, true);
+
+	std::string param_roadmap_nodes;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/roadmap/nodes", param_roadmap_nodes);
+	nh.param(param_roadmap_nodes, roadmap_nodes_, 500);
+
+	std::string param_roadmap_connection_radius;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/roadmap/connection_radius", param_roadmap_connection_radius);
+	nh.param(param_roadmap_connection_radius, roadmap_connection_radius_, 3.0);
+
+	std::string param_roadmap_prefetch_goals;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/roadmap/prefetch_goals", param_roadmap_prefetch_goals);
+	nh.param(param_roadmap_prefetch_goals, roadmap_prefetch_goals_, 3);
+
+	std::string param_roadmap_seed;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/roadmap/seed", param_roadmap_seed);
+	nh.param(param_roadmap_seed, roadmap_seed_, 0);
+
+	std::string param_flow_field_enabled;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/flow_field/enabled", param_flow_field_enabled);
+	nh.param(param_flow_field_enabled, flow_field_enabled_, false);
+
+	std::string param_flow_field_max_vel_lin;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/flow_field/max_vel_lin", param_flow_field_max_vel_lin);
+	nh.param(param_flow_field_max_vel_lin, flow_field_max_vel_lin_, 0.5);
+
+	std::string param_flow_field_max_vel_ang;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/flow_field/max_vel_ang", param_flow_field_max_vel_ang);
+	nh.param(param_flow_field_max_vel_ang, flow_field_max_vel_ang_, 1.0);
+
+	std::string param_flow_field_lookahead;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/flow_field/lookahead", param_flow_field_lookahead);
+	nh.param(param_flow_field_lookahead, flow_field_lookahead_, 0.5);
+
+	std::string param_flow_field_goal_tolerance;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/flow_field/goal_tolerance", param_flow_field_goal_tolerance);
+	nh.param(param_flow_field_goal_tolerance, flow_field_goal_tolerance_, 0.2);
+
+	if (flow_field_enabled_) {
+		flow_field_cache_ptr_ = FlowFieldCache::getSharedCache();
+	}
+	static_map_cache_ptr_ = StaticMapCache::getSharedCache();
+
+	// publication of odometry and transforms
+	odom_governor_.setParameters(
+		PublicationGovernor::loadParameters(
+			"/hubero_ros/" + actor_name + "/publication/odometry",
+			PublicationGovernor::Parameters(50.0)
+		)
+	);
+	// TF topic is always subscribed, at least by the TransformService, so laziness would not change anything
+	tf_governor_.setParameters(
+		PublicationGovernor::loadParameters(
+			"/hubero_ros/" + actor_name + "/publication/tf",
+			PublicationGovernor::Parameters(0.0, 1, false)
+		)
+	);
+
+	std::string param_tf_batched;
+	nh.searchParam("/hubero_ros/" + actor_name + "/navigation/tf_batched", param_tf_batched);
+	nh.param(param_tf_batched, tf_batched_, true);
+
 	// initialize publishers, service clients, subscribers
+	tf_service_ptr_ = std::make_shared<TransformService>(node_ptr->getNodeHandlePtr());
+
 	srv_mb_get_plan_ = node_ptr->getNodeHandlePtr()->serviceClient<nav_msgs::GetPlan>(
 		srv_nav_get_plan
 	);
@@ -138,6 +243,13 @@ bool NavigationRos::initialize(
 		this
 	);
 
+	sub_map_ = node_ptr->getNodeHandlePtr()->subscribe(
+		topic_map,
+		1,
+		&NavigationRos::callbackMap,
+		this
+	);
+
 	if (!srv_mb_get_plan_.isValid()) {
 		HUBERO_LOG(
 			"[%s].[NavigationRos] Navigation stack '%s' service is not valid\r\n",
@@ -150,12 +262,14 @@ bool NavigationRos::initialize(
 		"\t(srv) get plan     client at '%s'\r\n"
 		"\t(sub) cmd vel      topic  at '%s'\r\n"
 		"\t(sub) feedback     topic  at '%s'\r\n"
-		"\t(sub) result       topic  at '%s'\r\n",
+		"\t(sub) result       topic  at '%s'\r\n"
+		"\t(sub) map          topic  at '%s'\r\n",
 		actor_name.c_str(),
 		srv_nav_get_plan.c_str(),
 		topic_nav_cmd.c_str(),
 		topic_nav_feedback.c_str(),
-		topic_nav_result.c_str()
+		topic_nav_result.c_str(),
+		topic_map.c_str()
 	);
 	return true;
 }
@@ -199,23 +313,86 @@ void NavigationRos::update(const Pose3& pose, const Vector3& vel_lin, const Vect
 		nav_action_server_connected_ = true;
 	}
 
+	auto stamp = ros::Time::now();
+
 	// service server connection
-	if (!nav_srv_mb_get_plan_exists_ && srv_mb_get_plan_.exists()) {
-		HUBERO_LOG(
-			"[%s].[NavigationRos] Navigation stack '%s' service finally exists\r\n",
-			actor_name_.c_str(),
-			srv_mb_get_plan_.getService().c_str()
-		);
-		nav_srv_mb_get_plan_exists_ = true;
+	if (
+		!nav_srv_mb_get_plan_exists_
+		&& (stamp - nav_srv_check_stamp_).toSec() >= NavigationRos::SERVICE_CHECK_PERIOD
+	) {
+		nav_srv_check_stamp_ = stamp;
+		if (srv_mb_get_plan_.exists()) {
+			HUBERO_LOG(
+				"[%s].[NavigationRos] Navigation stack '%s' service finally exists\r\n",
+				actor_name_.c_str(),
+				srv_mb_get_plan_.getService().c_str()
+			);
+			nav_srv_mb_get_plan_exists_ = true;
+		}
 	}
 
 	// do not call base class update - let Navigation stack take care about feedback update and goal reaching
 	current_pose_ = pose;
 
+	if (flow_field_active_) {
+		updateFlowField(pose);
+	}
+
 	// publish odom
+	if (odom_governor_.isPublishRequired(stamp, pub_odom_.getNumSubscribers())) {
+		publishOdometry(pose, vel_lin, vel_ang, stamp);
+	}
+
+	// publish TF
+	if (tf_governor_.isPublishRequired(stamp)) {
+		publishTransforms(pose, stamp);
+	}
+
+	// goals and plans are transformed between the world frame and the actor frames
+	if (!nav_tf_available_) {
+		Pose3 transform;
+		std::string error;
+		if (tf_service_ptr_->findTransform(getWorldFrame(), frame_base_, transform, error)) {
+			HUBERO_LOG(
+				"[%s].[NavigationRos] Transform from '%s' to '%s' is available\r\n",
+				actor_name_.c_str(),
+				getWorldFrame().c_str(),
+				frame_base_.c_str()
+			);
+			nav_tf_available_ = true;
+		}
+	}
+
+	/*
+	 * It's ugly to start action client here, but it seems that move_base waits for odom msg to be received and then
+	 * is ready to start. Trying to start the action client in @ref initialize freezes everything. This was helpful:
+	 * https://answers.ros.org/question/345012/move_base-action-topics-exist-but-client-stuck-on-waitforserver/
+	 */
+	if (nav_action_client_ptr_ == nullptr) {
+		// find action client namespace, based on e.g. odom topic
+		auto action_ns = pub_odom_.getTopic();
+		if (action_ns.back() == '/') {
+			action_ns.pop_back();
+		}
+		auto action_ns_separator = action_ns.find_last_of("/");
+		action_ns = action_ns.substr(0, action_ns_separator);
+
+		nav_action_client_ptr_ = std::make_shared<actionlib::SimpleActionClient<move_base_msgs::MoveBaseAction>>(
+			action_ns,
+			true
+		);
+	}
+}
+
+void NavigationRos::publishOdometry(
+	const Pose3& pose,
+	const Vector3& vel_lin,
+	const Vector3& vel_ang,
+	const ros::Time& stamp
+) {
 	nav_msgs::Odometry odometry {};
 	// header
-	odometry.header.stamp = ros::Time::now();
+	odometry.header.stamp = stamp;
 	odometry.header.frame_id = frame_local_ref_;
 	odometry.child_frame_id = frame_base_;
 	// pose
@@ -235,7 +412,9 @@ void NavigationRos::update(const Pose3& pose, const Vector3& vel_lin, const Vect
 	odometry.twist.twist = ignVectorsToMsgTwist(vel_lin_base, vel_ang_base);
 	setIdealCovariance(odometry.twist.covariance);
 	pub_odom_.publish(odometry);
+}
 
+void NavigationRos::publishTransforms(const Pose3& pose, const ros::Time& stamp) {
 	/*
 	 * Find TFs: world->map, map->odom to publish odometry etc.
 	 * NOTE: this is a hack, compared to a typical approach with a real robot, but poses from simulator are expressed
@@ -249,43 +428,28 @@ void NavigationRos::update(const Pose3& pose, const Vector3& vel_lin, const Vect
 
 	// publish odom TF
 	geometry_msgs::TransformStamped transform_odom {};
-	transform_odom.header.stamp = ros::Time::now();
+	transform_odom.header.stamp = stamp;
 	transform_odom.header.frame_id = getGlobalReferenceFrame();
 	transform_odom.child_frame_id = frame_local_ref_;
 	// ignore height of the pose in this step - this will produce odometry frame at the same height as global ref frame
 	Pose3 pose_initial_plane(Vector3(pose_initial_.Pos().X(), pose_initial_.Pos().Y(), 0.0), pose_initial_.Rot());
 	transform_odom.transform = ignPoseToMsgTf(pose_initial_plane + global_ref_shift);
-	tf_broadcaster_.sendTransform(transform_odom);
 
 	// publish actor base TF
 	geometry_msgs::TransformStamped transform_actor {};
-	transform_actor.header.stamp = ros::Time::now();
+	transform_actor.header.stamp = stamp;
 	transform_actor.header.frame_id = frame_local_ref_;
 	transform_actor.child_frame_id = frame_base_;
 	// elevate with pose_initial_.Pos().Z() that was ignored in the previous TF
 	Pose3 pose_base(pose - pose_initial_);
 	pose_base.Pos().Z() += pose_initial_.Pos().Z();
 	transform_actor.transform = ignPoseToMsgTf(pose_base);
-	tf_broadcaster_.sendTransform(transform_actor);
-
-	/*
-	 * It's ugly to start action client here, but it seems that move_base waits for odom msg to be received and then
-	 * is ready to start. Trying to start the action client in @ref initialize freezes everything. This was helpful:
-	 * https://answers.ros.org/question/345012/move_base-action-topics-exist-but-client-stuck-on-waitforserver/
-	 */
-	if (nav_action_client_ptr_ == nullptr) {
-		// find action client namespace, based on e.g. odom topic
-		auto action_ns = pub_odom_.getTopic();
-		if (action_ns.back() == '/') {
-			action_ns.pop_back();
-		}
-		auto action_ns_separator = action_ns.find_last_of("/");
-		action_ns = action_ns.substr(0, action_ns_separator);
 
-		nav_action_client_ptr_ = std::make_shared<actionlib::SimpleActionClient<move_base_msgs::MoveBaseAction>>(
-			action_ns,
-			true
-		);
+	std::vector<geometry_msgs::TransformStamped> transforms {transform_odom, transform_actor};
+	if (tf_batched_) {
+		tf_service_ptr_->sendTransforms(transforms);
+	} else {
+		tf_broadcaster_.sendTransform(transforms);
 	}
 }
 
@@ -295,6 +459,25 @@ bool NavigationRos::setGoal(const Pose3& pose, const std::string& frame) {
 		return false;
 	}
 
+	if (flow_field_enabled_ && setGoalFlowField(pose, frame)) {
+		NavigationBase::setGoal(pose, frame);
+		feedback_latest_.write(feedback_);
+		// navigation stack must not drive the actor simultaneously
+		if (nav_action_server_connected_) {
+			nav_action_client_ptr_->cancelAllGoals();
+		}
+		HUBERO_LOG(
+			"[%s].[NavigationRos] Set flow field goal: x %1.2f, y %1.2f (frame: %s), fields shared: %lu\r\n",
+			actor_name_.c_str(),
+			pose.Pos().X(),
+			pose.Pos().Y(),
+			frame.c_str(),
+			flow_field_cache_ptr_->getSize()
+		);
+		return true;
+	}
+	stopFlowField();
+
 	if (!nav_action_server_connected_) {
 		HUBERO_LOG(
 			"[%s].[NavigationRos] Did not manage to connect to ROS action server yet, ignoring 'setGoal' request\r\n",
@@ -325,6 +508,7 @@ bool NavigationRos::setGoal(const Pose3& pose, const std::string& frame) {
 	}
 
 	NavigationBase::setGoal(pose, frame);
+	feedback_latest_.write(feedback_);
 
 	/*
 	 * - SimpleDoneCallback: returns action status with a big delay (compared to topic data) that interferes HuBeRo
@@ -357,6 +541,13 @@ bool NavigationRos::cancelGoal() {
 		return false;
 	}
 
+	if (stopFlowField()) {
+		NavigationBase::cancelGoal();
+		feedback_latest_.write(feedback_);
+		HUBERO_LOG("[%s].[NavigationRos] Cancelled flow field goal\r\n", actor_name_.c_str());
+		return true;
+	}
+
 	if (!nav_action_server_connected_) {
 		HUBERO_LOG(
 			"[%s].[NavigationRos] Did not manage to connect to ROS action server yet, ignoring 'cancelGoal' request\r\n",
@@ -366,6 +557,7 @@ bool NavigationRos::cancelGoal() {
 	}
 
 	NavigationBase::cancelGoal();
+	feedback_latest_.write(feedback_);
 	nav_action_client_ptr_->cancelGoal();
 	HUBERO_LOG("[%s].[NavigationRos] Trying to cancel all navigation goals\r\n", actor_name_.c_str());
 	return true;
@@ -377,6 +569,12 @@ void NavigationRos::finish() {
 		return;
 	}
 
+	if (stopFlowField()) {
+		NavigationBase::finish();
+		feedback_latest_.write(feedback_);
+		return;
+	}
+
 	if (!nav_action_server_connected_) {
 		HUBERO_LOG(
 			"[%s].[NavigationRos] Did not manage to connect to ROS action server yet, ignoring 'finish' call\r\n",
@@ -387,6 +585,7 @@ void NavigationRos::finish() {
 
 	nav_action_client_ptr_->cancelAllGoals();
 	NavigationBase::finish();
+	feedback_latest_.write(feedback_);
 }
 
 std::tuple<bool, Pose3> NavigationRos::computeClosestAchievablePose(const Pose3& pose, const std::string& frame) {
@@ -403,6 +602,10 @@ std::tuple<bool, Pose3> NavigationRos::computeClosestAchievablePose(const Pose3&
 		return std::make_tuple(false, pose);
 	}
 
+	if (isIncrementalPlanningSupported()) {
+		return computeClosestAchievablePoseIncremental(pose, frame);
+	}
+
 	// compute plan
 	auto path = computePlan(current_pose_, getWorldFrame(), pose, frame);
 
@@ -416,12 +619,22 @@ std::tuple<bool, Pose3> NavigationRos::computeClosestAchievablePose(const Pose3&
 	return std::make_tuple(goal_pose_ok, goal_pose_potential);
 }
 
+bool NavigationRos::isIncrementalPlanningSupported() const {
+	const std::lock_guard<std::mutex> lock(mutex_map_);
+	return map_ptr_ != nullptr || map_received_ptr_ != nullptr;
+}
+
 std::tuple<bool, Pose3> NavigationRos::findRandomReachableGoal() {
 	if (!isInitialized()) {
 		HUBERO_LOG("[%s].[NavigationRos] Not initialized, call `initialize` first\r\n", actor_name_.c_str());
 		return std::make_tuple(false, Pose3());
 	}
 
+	updateMap();
+	if (roadmap_ptr_ != nullptr) {
+		return findRandomReachableGoalRoadmap();
+	}
+
 	if (!nav_action_server_connected_) {
 		HUBERO_LOG(
 			"[%s].[NavigationRos] Did not manage to connect to ROS action server yet, ignoring request\r\n",
@@ -498,6 +711,11 @@ Vector3 NavigationRos::getVelocityCmd() const {
 		return Vector3();
 	}
 
+	// commands are expressed in the actor base frame
+	if (flow_field_active_) {
+		return NavigationBase::convertCommandToGlobalCs(current_pose_.Rot().Yaw(), cmd_vel_local_.read());
+	}
+
 	if (!nav_action_server_connected_) {
 		HUBERO_LOG(
 			"[%s].[NavigationRos] Did not manage to connect to ROS action server yet, ignoring 'getVelocityCmd'\r\n",
@@ -506,7 +724,15 @@ Vector3 NavigationRos::getVelocityCmd() const {
 		return Vector3();
 	}
 
-	return cmd_vel_;
+	return NavigationBase::convertCommandToGlobalCs(current_pose_.Rot().Yaw(), cmd_vel_local_.read());
+}
+
+TaskFeedbackType NavigationRos::getFeedback() const {
+	return feedback_latest_.read();
+}
+
+bool NavigationRos::isReady() const {
+	return isInitialized() && nav_action_server_connected_ && nav_srv_mb_get_plan_exists_ && nav_tf_available_;
 }
 
 // static
@@ -546,57 +772,131 @@ bool NavigationRos::isMoveBaseBusy(const actionlib::SimpleClientGoalState& state
 }
 
 void NavigationRos::callbackCmdVel(const geometry_msgs::Twist::ConstPtr& msg) {
-	const std::lock_guard<std::mutex> lock(mutex_callback_);
-	Vector3 cmd_vel_local;
-	cmd_vel_local.X(msg->linear.x);
-	cmd_vel_local.Y(msg->linear.y);
-	cmd_vel_local.Z(msg->angular.z);
-	cmd_vel_ = NavigationBase::convertCommandToGlobalCs(current_pose_.Rot().Yaw(), cmd_vel_local);
+	// commands are computed locally during flow field navigation
+	if (flow_field_active_) {
+		return;
+	}
+	// conversion to the global coordinate system is done in the simulation thread, where the actor pose is known
+	cmd_vel_local_.write(Vector3(msg->linear.x, msg->linear.y, msg->angular.z));
 }
 
 void NavigationRos::callbackFeedback(const move_base_msgs::MoveBaseActionFeedback::ConstPtr& msg) {
-	const std::lock_guard<std::mutex> lock(mutex_callback_);
+	// status of goals cancelled by the flow field navigation must not override its feedback
+	if (flow_field_active_) {
+		return;
+	}
 	auto fb_type = convertActionStatusToTaskFeedback(msg->status.status);
 	if (fb_type == TASK_FEEDBACK_UNDEFINED) {
 		return;
 	}
-	feedback_ = fb_type;
+	feedback_latest_.write(fb_type);
 }
 
 void NavigationRos::callbackResult(const move_base_msgs::MoveBaseActionResult::ConstPtr& msg) {
-	const std::lock_guard<std::mutex> lock(mutex_callback_);
+	// status of goals cancelled by the flow field navigation must not override its feedback
+	if (flow_field_active_) {
+		return;
+	}
 	auto fb_type = convertActionStatusToTaskFeedback(msg->status.status);
 	if (fb_type == TASK_FEEDBACK_UNDEFINED) {
 		return;
 	}
-	feedback_ = fb_type;
+	feedback_latest_.write(fb_type);
+}
+
+void NavigationRos::callbackMap(const nav_msgs::OccupancyGrid::ConstPtr& msg) {
+	if (msg->info.width == 0 || msg->info.height == 0) {
+		return;
+	}
+	if (std::abs(msgPoseToIgnPose(msg->info.origin).Rot().Yaw()) > 1e-03) {
+		HUBERO_LOG(
+			"[%s].[NavigationRos] Rotated maps are not supported by the incremental planner, ignoring map\r\n",
+			actor_name_.c_str()
+		);
+		return;
+	}
+
+	OccupancyGrid map(
+		msg->info.width,
+		msg->info.height,
+		msg->info.resolution,
+		msg->info.origin.position.x,
+		msg->info.origin.position.y
+	);
+	auto& data = map.getData();
+	for (size_t i = 0; i < data.size() && i < msg->data.size(); i++) {
+		// unknown cells (-1) are treated as occupied
+		data[i] = (msg->data[i] < 0 || msg->data[i] > 50) ? 1 : 0;
+	}
+
+	// inflation and precomputation of the planning structures are done outside of the simulation thread,
+	// the planner grabs the map later; all actors receiving the same map share its structures
+	StaticMapCache::Parameters params;
+	params.inflation_radius = planner_inflation_radius_;
+	// region graph serves plans for random goals, which are drawn from the roadmap if it is enabled
+	params.region_graph = hierarchical_planning_ && !roadmap_enabled_;
+	params.region_size = planner_region_size_;
+	params.roadmap = roadmap_enabled_;
+	params.roadmap_nodes = static_cast<size_t>(std::max(roadmap_nodes_, 1));
+	params.roadmap_connection_radius = roadmap_connection_radius_;
+	params.roadmap_seed = static_cast<unsigned int>(roadmap_seed_);
+	auto products = static_map_cache_ptr_->get(map, params);
+
+	auto map_ptr = products.map_ptr;
+	// flow fields are shared only among actors operating on the same map instance
+	if (flow_field_cache_ptr_ != nullptr) {
+		map_ptr = flow_field_cache_ptr_->share(map_ptr);
+	}
+
+	if (products.roadmap_ptr != nullptr) {
+		HUBERO_LOG(
+			"[%s].[NavigationRos] Using roadmap with %lu nodes, %lu edges and %lu components\r\n",
+			actor_name_.c_str(),
+			products.roadmap_ptr->getNodesNum(),
+			products.roadmap_ptr->getEdgesNum(),
+			products.roadmap_ptr->getComponentsNum()
+		);
+	}
+
+	const std::lock_guard<std::mutex> lock(mutex_map_);
+	map_received_ptr_ = map_ptr;
+	region_planner_received_ptr_ = products.region_planner_ptr;
+	roadmap_received_ptr_ = products.roadmap_ptr;
+	HUBERO_LOG(
+		"[%s].[NavigationRos] Received map of size %dx%d for the local planners\r\n",
+		actor_name_.c_str(),
+		map_ptr->getWidth(),
+		map_ptr->getHeight()
+	);
 }
 
 std::tuple<bool, Pose3> NavigationRos::findTransform(const std::string& frame_source, const std::string& frame_target) const {
 	Pose3 transform;
-	bool success = false;
-	try {
-		auto tf_msg = tf_buffer_.lookupTransform(frame_target, frame_source, ros::Time(0));
-		transform = msgTfToPose(tf_msg.transform);
-		success = true;
-	} catch (tf2::TransformException& ex) {
+	std::string error;
+	bool success = tf_service_ptr_->findTransform(frame_source, frame_target, transform, error);
+	if (!success) {
 		HUBERO_LOG(
 			"[%s].[NavigationRos] Could not transform '%s' to '%s' - exception: '%s'\r\n",
 			actor_name_.c_str(),
-			getWorldFrame().c_str(),
-			getGlobalReferenceFrame().c_str(),
-			ex.what()
+			frame_source.c_str(),
+			frame_target.c_str(),
+			error.c_str()
 		);
 	}
 	return std::make_tuple(success, transform);
 }
 
-nav_msgs::Path NavigationRos::computePlan(
+Path NavigationRos::computePlan(
 	const Pose3& start_pose,
 	const std::string& start_frame,
 	const Pose3& goal_pose,
 	const std::string& goal_frame
 ) {
+	updateMap();
+	if (region_planner_ptr_ != nullptr) {
+		return computePlanHierarchical(start_pose, start_frame, goal_pose, goal_frame);
+	}
+
 	/*
 	 * computePlan in a nutshell:
 	 * store backup of the current goal, abort it, compute plan
@@ -628,7 +928,7 @@ nav_msgs::Path NavigationRos::computePlan(
 			"[%s].[NavigationRos] Could not compute valid plan because of TF lookup failure\r\n",
 			actor_name_.c_str()
 		);
-		return nav_msgs::Path();
+		return Path();
 	}
 
 	auto pose_start_global_ref = start_pose + transform_start;
@@ -682,7 +982,7 @@ nav_msgs::Path NavigationRos::computePlan(
 	 */
 	bool success = srv_mb_get_plan_.call(req, resp);
 	if (!success) {
-		return nav_msgs::Path();;
+		return Path();
 	}
 
 	// restore previous goal if it's a valid one
@@ -706,7 +1006,7 @@ nav_msgs::Path NavigationRos::computePlan(
 			goal_pose.Pos().Y(),
 			nav_get_plan_tolerance_
 		);
-		return nav_msgs::Path();
+		return Path();
 	}
 
 	HUBERO_LOG(
@@ -722,24 +1022,398 @@ nav_msgs::Path NavigationRos::computePlan(
 		resp.plan.poses.end()[-2].pose.position.y
 	);
 
+	Path path;
+	path.reserve(resp.plan.poses.size());
+	for (const auto& pose: resp.plan.poses) {
+		// only the yaw of the quaternion is needed
+		const auto& q = pose.pose.orientation;
+		path.push_back(
+			pose.pose.position.x,
+			pose.pose.position.y,
+			std::atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z))
+		);
+	}
 	// convert to the world frame, if needed
 	if (getGlobalReferenceFrame() != getWorldFrame()) {
-		for (auto& pose: resp.plan.poses) {
-			Pose3 posehubero = msgPoseToIgnPose(pose.pose);
-			posehubero = posehubero + transform_world;
-			pose.pose = ignPoseToMsgPose(posehubero);
-			pose.header.frame_id = getWorldFrame();
+		path.transform(transform_world);
+	}
+	return path;
+}
+
+Path NavigationRos::computePlanHierarchical(
+	const Pose3& start_pose,
+	const std::string& start_frame,
+	const Pose3& goal_pose,
+	const std::string& goal_frame
+) {
+	// map is expressed in the global reference frame
+	bool transform_start_valid = false;
+	Pose3 transform_start;
+	std::tie(transform_start_valid, transform_start) = findTransform(start_frame, getGlobalReferenceFrame());
+
+	bool transform_goal_valid = false;
+	Pose3 transform_goal;
+	std::tie(transform_goal_valid, transform_goal) = findTransform(goal_frame, getGlobalReferenceFrame());
+
+	bool transform_world_valid = false;
+	Pose3 transform_world;
+	std::tie(transform_world_valid, transform_world) = findTransform(getGlobalReferenceFrame(), getWorldFrame());
+
+	if (!transform_start_valid || !transform_goal_valid || !transform_world_valid) {
+		HUBERO_LOG(
+			"[%s].[NavigationRos] Could not compute valid plan because of TF lookup failure\r\n",
+			actor_name_.c_str()
+		);
+		return Path();
+	}
+
+	auto pose_start_global_ref = start_pose + transform_start;
+	auto pose_goal_global_ref = goal_pose + transform_goal;
+
+	// both actor and the goal may be located inside the inflated obstacles - find the closest free cells then
+	int tolerance_cells = static_cast<int>(std::ceil(nav_get_plan_tolerance_ / map_ptr_->getResolution()));
+	OccupancyGrid::Cell cell_start;
+	OccupancyGrid::Cell cell_goal;
+	map_ptr_->worldToCell(pose_start_global_ref.Pos().X(), pose_start_global_ref.Pos().Y(), cell_start);
+	map_ptr_->worldToCell(pose_goal_global_ref.Pos().X(), pose_goal_global_ref.Pos().Y(), cell_goal);
+	if (
+		!map_ptr_->findNearestFree(cell_start, tolerance_cells, cell_start)
+		|| !map_ptr_->findNearestFree(cell_goal, tolerance_cells, cell_goal)
+		|| !region_planner_ptr_->plan(cell_start, cell_goal, region_query_)
+	) {
+		HUBERO_LOG(
+			"[%s].[NavigationRos] Couldn't find a plan from {x %2.1f, y %2.1f} to {x %2.1f, y %2.1f} despite tolerance of %2.4f\r\n",
+			actor_name_.c_str(),
+			start_pose.Pos().X(),
+			start_pose.Pos().Y(),
+			goal_pose.Pos().X(),
+			goal_pose.Pos().Y(),
+			nav_get_plan_tolerance_
+		);
+		return Path();
+	}
+
+	// "planarized" poses, oriented along the path
+	auto path = Path::fromCells(*map_ptr_, region_query_.path, pose_start_global_ref.Rot().Yaw());
+	auto pose_goal_global_ref_plane = pose_goal_global_ref;
+	pose_goal_global_ref_plane.Pos().Z(0.0);
+	path.push_back(
+		pose_goal_global_ref_plane.Pos().X(),
+		pose_goal_global_ref_plane.Pos().Y(),
+		pose_goal_global_ref_plane.Rot().Yaw()
+	);
+	path.transform(transform_world);
+
+	HUBERO_LOG(
+		"[%s].[NavigationRos] Computed plan with %lu poses (goal: {%2.2f, %2.2f}) using %lu of %lu map regions\r\n",
+		actor_name_.c_str(),
+		path.size(),
+		pose_goal_global_ref_plane.Pos().X(),
+		pose_goal_global_ref_plane.Pos().Y(),
+		region_query_.corridor.size(),
+		region_planner_ptr_->getRegionsNum()
+	);
+	return path;
+}
+
+void NavigationRos::updateMap() {
+	// swap the map once a new one arrives
+	const std::lock_guard<std::mutex> lock(mutex_map_);
+	if (map_received_ptr_ == nullptr) {
+		return;
+	}
+	map_ptr_ = map_received_ptr_;
+	map_received_ptr_.reset();
+	planner_.initialize(map_ptr_);
+	planner_.setRerootDistance(
+		static_cast<int>(std::ceil(PLANNER_REROOT_DISTANCE / map_ptr_->getResolution()))
+	);
+	region_planner_ptr_ = region_planner_received_ptr_;
+	region_planner_received_ptr_.reset();
+	roadmap_ptr_ = roadmap_received_ptr_;
+	roadmap_received_ptr_.reset();
+
+	// prefetcher operates on immutable copies, so it does not interfere with further map updates
+	goal_prefetcher_ptr_.reset();
+	if (roadmap_ptr_ != nullptr && roadmap_prefetch_goals_ > 0) {
+		auto map_ptr = map_ptr_;
+		auto roadmap_ptr = roadmap_ptr_;
+		double tolerance = nav_get_plan_tolerance_;
+		goal_prefetcher_ptr_ = std::make_shared<GoalPrefetcher>(
+			[map_ptr, roadmap_ptr, tolerance](const Pose3& start) {
+				static thread_local std::mt19937 gen(std::random_device{}());
+				return NavigationRos::sampleGoalRoadmap(*map_ptr, *roadmap_ptr, start, tolerance, gen);
+			},
+			static_cast<size_t>(roadmap_prefetch_goals_)
+		);
+	}
+}
+
+std::tuple<bool, Pose3> NavigationRos::findRandomReachableGoalRoadmap() {
+	// map is expressed in the global reference frame
+	bool transform_start_valid = false;
+	Pose3 transform_start;
+	std::tie(transform_start_valid, transform_start) = findTransform(getWorldFrame(), getGlobalReferenceFrame());
+	if (!transform_start_valid) {
+		return std::make_tuple(false, Pose3());
+	}
+
+	auto pose_start_global_ref = current_pose_ + transform_start;
+
+	// goals prefetched from the previous goal are valid only if the actor actually reached it
+	bool goal_valid = false;
+	Pose3 goal;
+	double dist_to_prefetch_start = std::hypot(
+		goal_prefetch_start_.Pos().X() - pose_start_global_ref.Pos().X(),
+		goal_prefetch_start_.Pos().Y() - pose_start_global_ref.Pos().Y()
+	);
+	if (
+		goal_prefetcher_ptr_ != nullptr
+		&& dist_to_prefetch_start <= nav_get_plan_tolerance_
+		&& goal_prefetcher_ptr_->pop(goal)
+	) {
+		goal_valid = true;
+	} else {
+		std::tie(goal_valid, goal) = NavigationRos::sampleGoalRoadmap(
+			*map_ptr_,
+			*roadmap_ptr_,
+			pose_start_global_ref,
+			nav_get_plan_tolerance_,
+			roadmap_gen_
+		);
+	}
+
+	if (!goal_valid) {
+		HUBERO_LOG("[%s].[NavigationRos] Could not randomly choose a goal from the roadmap\r\n", actor_name_.c_str());
+		return std::make_tuple(false, Pose3());
+	}
+
+	// next goals are sampled in the background while the actor moves to this one
+	if (goal_prefetcher_ptr_ != nullptr) {
+		goal_prefetcher_ptr_->setStart(goal);
+		goal_prefetch_start_ = goal;
+	}
+	return std::make_tuple(true, goal);
+}
+
+// static
+std::tuple<bool, Pose3> NavigationRos::sampleGoalRoadmap(
+	const OccupancyGrid& map,
+	const Roadmap& roadmap,
+	const Pose3& start,
+	double tolerance,
+	std::mt19937& gen
+) {
+	// start may be located inside the inflated obstacles - find the closest free cell then
+	int tolerance_cells = static_cast<int>(std::ceil(tolerance / map.getResolution()));
+	OccupancyGrid::Cell cell_start;
+	OccupancyGrid::Cell cell_goal;
+	std::vector<OccupancyGrid::Cell> path;
+	double path_cost = 0.0;
+	if (
+		!map.worldToCell(start.Pos().X(), start.Pos().Y(), cell_start)
+		|| !map.findNearestFree(cell_start, tolerance_cells, cell_start)
+		|| !roadmap.sampleReachable(cell_start, gen, cell_goal)
+		|| !roadmap.plan(cell_start, cell_goal, path, path_cost)
+	) {
+		return std::make_tuple(false, Pose3());
+	}
+
+	// orientation is determined by the last segment of the path
+	double yaw = start.Rot().Yaw();
+	if (path.size() >= 2 && path.end()[-2] != cell_goal) {
+		const auto& cell_prev = path.end()[-2];
+		yaw = std::atan2(cell_goal.y - cell_prev.y, cell_goal.x - cell_prev.x);
+	}
+
+	double x = 0.0;
+	double y = 0.0;
+	map.cellToWorld(cell_goal, x, y);
+	// "planarized" pose
+	return std::make_tuple(true, Pose3(x, y, 0.0, 0.0, 0.0, yaw));
+}
+
+bool NavigationRos::setGoalFlowField(const Pose3& pose, const std::string& frame) {
+	updateMap();
+	if (map_ptr_ == nullptr || flow_field_cache_ptr_ == nullptr) {
+		return false;
+	}
+
+	// map is expressed in the global reference frame
+	bool transform_start_valid = false;
+	Pose3 transform_start;
+	std::tie(transform_start_valid, transform_start) = findTransform(getWorldFrame(), getGlobalReferenceFrame());
+
+	bool transform_goal_valid = false;
+	Pose3 transform_goal;
+	std::tie(transform_goal_valid, transform_goal) = findTransform(frame, getGlobalReferenceFrame());
+
+	if (!transform_start_valid || !transform_goal_valid) {
+		return false;
+	}
+
+	auto pose_start_global_ref = current_pose_ + transform_start;
+	auto pose_goal_global_ref = pose + transform_goal;
+
+	// goal cell is snapped to the closest free one, so actors heading to the same place share the field
+	int tolerance_cells = static_cast<int>(std::ceil(nav_get_plan_tolerance_ / map_ptr_->getResolution()));
+	OccupancyGrid::Cell cell_start;
+	OccupancyGrid::Cell cell_goal;
+	if (
+		!map_ptr_->worldToCell(pose_start_global_ref.Pos().X(), pose_start_global_ref.Pos().Y(), cell_start)
+		|| !map_ptr_->worldToCell(pose_goal_global_ref.Pos().X(), pose_goal_global_ref.Pos().Y(), cell_goal)
+		|| !map_ptr_->findNearestFree(cell_start, tolerance_cells, cell_start)
+		|| !map_ptr_->findNearestFree(cell_goal, tolerance_cells, cell_goal)
+	) {
+		return false;
+	}
+
+	auto field_ptr = flow_field_cache_ptr_->get(map_ptr_, cell_goal);
+	if (!field_ptr->isReachable(cell_start)) {
+		return false;
+	}
+
+	// goal snapped to the free cell is reachable
+	double x = 0.0;
+	double y = 0.0;
+	map_ptr_->cellToWorld(cell_goal, x, y);
+	OccupancyGrid::Cell cell_goal_requested;
+	map_ptr_->worldToCell(pose_goal_global_ref.Pos().X(), pose_goal_global_ref.Pos().Y(), cell_goal_requested);
+	if (cell_goal_requested != cell_goal) {
+		pose_goal_global_ref.Pos().X(x);
+		pose_goal_global_ref.Pos().Y(y);
+	}
+
+	flow_field_ptr_ = field_ptr;
+	flow_field_goal_ = pose_goal_global_ref;
+	flow_field_transform_ = transform_start;
+	flow_field_active_ = true;
+	return true;
+}
+
+void NavigationRos::updateFlowField(const Pose3& pose) {
+	auto pose_global_ref = pose + flow_field_transform_;
+	const auto& map = *flow_field_ptr_->getMap();
+
+	Vector3 cmd_vel_local;
+	auto feedback = TaskFeedbackType::TASK_FEEDBACK_ACTIVE;
+	double dist_to_goal = std::hypot(
+		flow_field_goal_.Pos().X() - pose_global_ref.Pos().X(),
+		flow_field_goal_.Pos().Y() - pose_global_ref.Pos().Y()
+	);
+	int tolerance_cells = static_cast<int>(std::ceil(nav_get_plan_tolerance_ / map.getResolution()));
+	OccupancyGrid::Cell cell;
+
+	if (dist_to_goal <= flow_field_goal_tolerance_) {
+		feedback = TaskFeedbackType::TASK_FEEDBACK_SUCCEEDED;
+	} else if (
+		!map.worldToCell(pose_global_ref.Pos().X(), pose_global_ref.Pos().Y(), cell)
+		|| !map.findNearestFree(cell, tolerance_cells, cell)
+		|| !flow_field_ptr_->isReachable(cell)
+	) {
+		// pushed away from the field, e.g., by other actors
+		feedback = TaskFeedbackType::TASK_FEEDBACK_ABORTED;
+	} else {
+		auto waypoint = flow_field_ptr_->getWaypoint(
+			cell,
+			std::max(1, static_cast<int>(std::round(flow_field_lookahead_ / map.getResolution())))
+		);
+		double x = flow_field_goal_.Pos().X();
+		double y = flow_field_goal_.Pos().Y();
+		if (waypoint != flow_field_ptr_->getGoal()) {
+			map.cellToWorld(waypoint, x, y);
 		}
+		double heading = std::atan2(y - pose_global_ref.Pos().Y(), x - pose_global_ref.Pos().X());
+		double heading_error = heading - pose_global_ref.Rot().Yaw();
+		heading_error = std::atan2(std::sin(heading_error), std::cos(heading_error));
+		// turn in place when the waypoint is behind, slow down near the goal
+		cmd_vel_local.X(
+			std::min(flow_field_max_vel_lin_, dist_to_goal) * std::max(0.0, std::cos(heading_error))
+		);
+		cmd_vel_local.Z(
+			std::max(
+				-flow_field_max_vel_ang_,
+				std::min(flow_field_max_vel_ang_, FLOW_FIELD_HEADING_GAIN * heading_error)
+			)
+		);
+	}
+
+	cmd_vel_local_.write(cmd_vel_local);
+	feedback_latest_.write(feedback);
+}
+
+bool NavigationRos::stopFlowField() {
+	if (!flow_field_active_) {
+		return false;
 	}
-	return resp.plan;
+	flow_field_active_ = false;
+	flow_field_ptr_.reset();
+	cmd_vel_local_.write(Vector3());
+	return true;
+}
+
+std::tuple<bool, Pose3> NavigationRos::computeClosestAchievablePoseIncremental(
+	const Pose3& pose,
+	const std::string& frame
+) {
+	updateMap();
+
+	// map is expressed in the global reference frame
+	bool transform_start_valid = false;
+	Pose3 transform_start;
+	std::tie(transform_start_valid, transform_start) = findTransform(getWorldFrame(), getGlobalReferenceFrame());
+
+	bool transform_goal_valid = false;
+	Pose3 transform_goal;
+	std::tie(transform_goal_valid, transform_goal) = findTransform(frame, getGlobalReferenceFrame());
+
+	bool transform_world_valid = false;
+	Pose3 transform_world;
+	std::tie(transform_world_valid, transform_world) = findTransform(getGlobalReferenceFrame(), getWorldFrame());
+
+	if (!transform_start_valid || !transform_goal_valid || !transform_world_valid) {
+		return std::make_tuple(false, pose);
+	}
+
+	auto pose_start_global_ref = current_pose_ + transform_start;
+	auto pose_goal_global_ref = pose + transform_goal;
+
+	// both actor and the goal may be located inside the inflated obstacles - find the closest free cells then
+	int tolerance_cells = static_cast<int>(std::ceil(nav_get_plan_tolerance_ / map_ptr_->getResolution()));
+	OccupancyGrid::Cell cell_start;
+	OccupancyGrid::Cell cell_goal;
+	map_ptr_->worldToCell(pose_start_global_ref.Pos().X(), pose_start_global_ref.Pos().Y(), cell_start);
+	map_ptr_->worldToCell(pose_goal_global_ref.Pos().X(), pose_goal_global_ref.Pos().Y(), cell_goal);
+	if (
+		!map_ptr_->findNearestFree(cell_start, tolerance_cells, cell_start)
+		|| !map_ptr_->findNearestFree(cell_goal, tolerance_cells, cell_goal)
+		|| !planner_.plan(cell_start, cell_goal)
+	) {
+		return std::make_tuple(false, pose);
+	}
+
+	// orientation is determined by the last segment of the path
+	double yaw = pose_start_global_ref.Rot().Yaw();
+	auto path = planner_.getPath();
+	if (path.size() >= 2) {
+		const auto& cell_prev = path.end()[-2];
+		yaw = std::atan2(cell_goal.y - cell_prev.y, cell_goal.x - cell_prev.x);
+	}
+
+	double x = 0.0;
+	double y = 0.0;
+	map_ptr_->cellToWorld(cell_goal, x, y);
+	// "planarized" pose converted to the world frame, as in computePlan
+	Pose3 pose_goal(x, y, 0.0, 0.0, 0.0, yaw);
+	return std::make_tuple(true, pose_goal + transform_world);
 }
 
-std::tuple<bool, Pose3> NavigationRos::selectGoalFromPlan(const nav_msgs::Path& path) {
+std::tuple<bool, Pose3> NavigationRos::selectGoalFromPlan(const Path& path) {
 	// goal pose is not reachable when plan consists of a set of valid poses + goal pose at the back of vector;
 	// NOTE: this is parameterized and can be disabled
-	if (path.poses.size() >= 2) {
+	if (path.size() >= 2) {
 		// second to last element in a vector
-		auto pose_goal = msgPoseToIgnPose(path.poses.end()[-2].pose);
+		auto pose_goal = path.getPose(path.size() - 2);
 		// evaluate quaternion of the new potential goal
 		bool goal_quaternion_valid = NavigationRos::isQuaternionValid(pose_goal.Rot());
 		if (!goal_quaternion_valid) {
@@ -753,7 +1427,7 @@ std::tuple<bool, Pose3> NavigationRos::selectGoalFromPlan(const nav_msgs::Path&
 		// quaternion is valid, let pose_goal be used elsewhere as new navigation goal
 		return std::make_tuple(true, pose_goal);
 
-	} else if (path.poses.empty()) {
+	} else if (path.empty()) {
 		HUBERO_LOG(
 			"[%s].[NavigationRos] Computed plan is empty - Aborting this attempt\r\n",
 			actor_name_.c_str()
@@ -764,7 +1438,7 @@ std::tuple<bool, Pose3> NavigationRos::selectGoalFromPlan(const nav_msgs::Path&
 	HUBERO_LOG(
 		"[%s].[NavigationRos] Computed plan is not empty (%d) but most likely contains something strange\r\n",
 		actor_name_.c_str(),
-		static_cast<int>(path.poses.size())
+		static_cast<int>(path.size())
 	);
 	return std::make_tuple(false, Pose3());
 }
@@ -9,6 +9,12 @@ namespace hubero {
 const int StatusRos::PUBLISHER_QUEUE_SIZE = 15;
 const ros::Duration StatusRos::UPDATE_PUBLISH_PERIOD = ros::Duration(0.02);
 int StatusRos::actor_num_ = 0;
+bool StatusRos::array_initialized_ = false;
+std::shared_ptr<PersonBatch> StatusRos::array_batch_ptr_;
+ros::Publisher StatusRos::pub_array_;
+PublicationGovernor StatusRos::pub_array_governor_;
+ros::Time StatusRos::array_step_stamp_;
+bool StatusRos::array_step_publish_ = false;
 
 StatusRos::StatusRos(): StatusBase::StatusBase(), actor_id_(StatusRos::actor_num_) {
     // increase counter for other instances
@@ -37,11 +43,20 @@ void StatusRos::initialize(
 	nh.searchParam("/hubero_ros/" + actor_name + "/status_topic", topic_status_param);
 	nh.param(topic_status_param, topic_status, std::string("actor/status"));
 
+    pub_governor_.setParameters(
+        PublicationGovernor::loadParameters(
+            "/hubero_ros/" + actor_name + "/publication/status",
+            PublicationGovernor::Parameters(1.0 / UPDATE_PUBLISH_PERIOD.toSec())
+        )
+    );
+
     pub_status_ = node_ptr->getNodeHandlePtr()->advertise<hubero_ros_msgs::Person>(
 		topic_status,
 		PUBLISHER_QUEUE_SIZE
 	);
 
+    StatusRos::initializeArray(node_ptr);
+
     HUBERO_LOG(
         "[%s].[StatusRos] Initialized ROS status publisher at '%s'\r\n",
         actor_name_.c_str(),
@@ -56,8 +71,10 @@ void StatusRos::update(const Pose3& pose, const Vector3& vel_lin, const Vector3&
 	}
 
     ros::Time time_current = ros::Time::now();
-    if ((time_current - time_last_pub_) < StatusRos::UPDATE_PUBLISH_PERIOD) {
-        // no need to publish that often
+    bool publish_status = pub_governor_.isPublishRequired(time_current, pub_status_.getNumSubscribers());
+    bool publish_array = StatusRos::isArrayPublishRequired(time_current);
+    if (!publish_status && !publish_array) {
+        // no need to publish that often or nobody listens
         return;
     }
 
@@ -82,9 +99,79 @@ void StatusRos::update(const Pose3& pose, const Vector3& vel_lin, const Vector3&
 
     // additional fields - currently undefined
 
-    pub_status_.publish(person);
-    // save timestamp
-    time_last_pub_ = time_current;
+    if (publish_status) {
+        pub_status_.publish(person);
+    }
+    if (publish_array) {
+        StatusRos::array_batch_ptr_->add(person);
+    }
+}
+
+void StatusRos::flush() {
+    if (StatusRos::array_batch_ptr_ == nullptr) {
+        return;
+    }
+    StatusRos::array_batch_ptr_->flush();
+}
+
+void StatusRos::initializeArray(std::shared_ptr<Node> node_ptr) {
+    if (StatusRos::array_initialized_) {
+        return;
+    }
+    StatusRos::array_initialized_ = true;
+
+    ros::NodeHandle nh;
+
+    bool enabled = false;
+    std::string param_enabled;
+    nh.searchParam("/hubero_ros/status_array/enabled", param_enabled);
+    nh.param(param_enabled, enabled, false);
+    if (!enabled) {
+        return;
+    }
+
+    std::string topic_array;
+    std::string topic_array_param;
+    nh.searchParam("/hubero_ros/status_array/topic", topic_array_param);
+    nh.param(topic_array_param, topic_array, std::string("people"));
+
+    StatusRos::pub_array_governor_.setParameters(
+        PublicationGovernor::loadParameters(
+            "/hubero_ros/publication/status_array",
+            PublicationGovernor::Parameters(1.0 / UPDATE_PUBLISH_PERIOD.toSec())
+        )
+    );
+
+    StatusRos::pub_array_ = node_ptr->getNodeHandlePtr()->advertise<hubero_ros_msgs::PersonArray>(
+        topic_array,
+        PUBLISHER_QUEUE_SIZE
+    );
+    // governor was already consulted before statuses were added, see 'isArrayPublishRequired'
+    StatusRos::array_batch_ptr_ = std::make_shared<PersonBatch>(
+        [](const hubero_ros_msgs::PersonArray& msg) {
+            StatusRos::pub_array_.publish(msg);
+        }
+    );
+
+    HUBERO_LOG(
+        "[StatusRos] Initialized ROS publisher of all actors statuses at '%s'\r\n",
+        StatusRos::pub_array_.getTopic().c_str()
+    );
+}
+
+bool StatusRos::isArrayPublishRequired(const ros::Time& stamp) {
+    if (StatusRos::array_batch_ptr_ == nullptr) {
+        return false;
+    }
+    // all actors share the stamp within a step, so only the first one consults the governor
+    if (stamp != StatusRos::array_step_stamp_) {
+        StatusRos::array_step_stamp_ = stamp;
+        StatusRos::array_step_publish_ = StatusRos::pub_array_governor_.isPublishRequired(
+            stamp,
+            StatusRos::pub_array_.getNumSubscribers()
+        );
+    }
+    return StatusRos::array_step_publish_;
 }
 
 } // namespace hubero
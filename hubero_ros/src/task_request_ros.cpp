@@ -5,11 +5,26 @@ namespace hubero {
 
 const std::string TaskRequestRos::OBJECT_ORIENTED_TASK_SUFFIX = "_name";
 const std::chrono::milliseconds TaskRequestRos::TASK_FEEDBACK_PERIOD = std::chrono::milliseconds(500);
-const int TaskRequestRos::TASK_PENDING_COUNTER_LIMIT = 5;
+const std::chrono::milliseconds TaskRequestRos::TASK_PENDING_TIMEOUT = std::chrono::milliseconds(2500);
+const std::chrono::milliseconds TaskRequestRos::TASK_TRANSITION_TIMEOUT = std::chrono::milliseconds(500);
+const std::string TaskRequestRos::BULK_TASK_REQUEST_NAME = "request_tasks";
+const std::chrono::milliseconds TaskRequestRos::BULK_TASK_FEEDBACK_PERIOD = std::chrono::milliseconds(100);
+
+TaskRequestRos::ActionServerPtr<hubero_ros_msgs::RequestTasksAction> TaskRequestRos::as_request_tasks_;
+std::map<std::string, TaskRequestRos*> TaskRequestRos::instances_;
+std::mutex TaskRequestRos::instances_mutex_;
+std::weak_ptr<TaskEventNotifier> TaskRequestRos::request_tasks_notifier_;
 
 TaskRequestRos::TaskRequestRos():
-	TaskRequestBase::TaskRequestBase(),
-	tf_listener_(tf_buffer_) {}
+	TaskRequestBase::TaskRequestBase() {}
+
+TaskRequestRos::~TaskRequestRos() {
+	std::lock_guard<std::mutex> lock(instances_mutex_);
+	auto it = instances_.find(actor_name_);
+	if (it != instances_.end() && it->second == this) {
+		instances_.erase(it);
+	}
+}
 
 void TaskRequestRos::initialize(
 	std::shared_ptr<Node> node_ptr,
@@ -23,6 +38,11 @@ void TaskRequestRos::initialize(
 
 	actor_name_ = actor_name;
 	world_frame_name_ = world_frame_name;
+	tf_service_ptr_ = std::make_shared<TransformService>(node_ptr->getNodeHandlePtr());
+	feedback_pub_params_ = PublicationGovernor::loadParameters(
+		"/hubero_ros/" + actor_name + "/publication/task_feedback",
+		PublicationGovernor::Parameters()
+	);
 
 	// convert task IDs to task names
 	auto name_task_stand = TaskRequestBase::getTaskName(TASK_STAND);
@@ -38,13 +58,14 @@ void TaskRequestRos::initialize(
 	// prepare task namespace
 	std::string task_ns = actor_name + "/" + node_ptr->getTaskNamespaceName() + "/";
 
-	// create action servers
+	// create action servers; preempt callbacks (also called once a new goal arrives) wake up the goal handlers
 	as_follow_object_ = std::make_shared<ActionServer<hubero_ros_msgs::FollowObjectAction>>(
 		*node_ptr->getNodeHandlePtr(),
 		task_ns + name_task_follow_object,
 		std::bind(&TaskRequestRos::actionCbFollowObject, this, std::placeholders::_1),
 		false
 	);
+	as_follow_object_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_FOLLOW_OBJECT));
 	as_follow_object_->start();
 
 	as_lie_down_ = std::make_shared<ActionServer<hubero_ros_msgs::LieDownAction>>(
@@ -53,6 +74,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbLieDown, this, std::placeholders::_1),
 		false
 	);
+	as_lie_down_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_LIE_DOWN));
 	as_lie_down_->start();
 
 	as_lie_down_object_ = std::make_shared<ActionServer<hubero_ros_msgs::LieDownObjectAction>>(
@@ -61,6 +83,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbLieDownObject, this, std::placeholders::_1),
 		false
 	);
+	as_lie_down_object_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_LIE_DOWN));
 	as_lie_down_object_->start();
 
 	as_move_around_ = std::make_shared<ActionServer<hubero_ros_msgs::MoveAroundAction>>(
@@ -69,6 +92,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbMoveAround, this, std::placeholders::_1),
 		false
 	);
+	as_move_around_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_MOVE_AROUND));
 	as_move_around_->start();
 
 	as_move_to_goal_ = std::make_shared<ActionServer<hubero_ros_msgs::MoveToGoalAction>>(
@@ -77,6 +101,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbMoveToGoal, this, std::placeholders::_1),
 		false
 	);
+	as_move_to_goal_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_MOVE_TO_GOAL));
 	as_move_to_goal_->start();
 
 	as_move_to_object_ = std::make_shared<ActionServer<hubero_ros_msgs::MoveToObjectAction>>(
@@ -85,6 +110,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbMoveToObject, this, std::placeholders::_1),
 		false
 	);
+	as_move_to_object_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_MOVE_TO_GOAL));
 	as_move_to_object_->start();
 
 	as_run_ = std::make_shared<ActionServer<hubero_ros_msgs::RunAction>>(
@@ -93,6 +119,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbRun, this, std::placeholders::_1),
 		false
 	);
+	as_run_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_RUN));
 	as_run_->start();
 
 	as_sit_down_ = std::make_shared<ActionServer<hubero_ros_msgs::SitDownAction>>(
@@ -101,6 +128,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbSitDown, this, std::placeholders::_1),
 		false
 	);
+	as_sit_down_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_SIT_DOWN));
 	as_sit_down_->start();
 
 	as_sit_down_object_ = std::make_shared<ActionServer<hubero_ros_msgs::SitDownObjectAction>>(
@@ -109,6 +137,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbSitDownObject, this, std::placeholders::_1),
 		false
 	);
+	as_sit_down_object_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_SIT_DOWN));
 	as_sit_down_object_->start();
 
 	as_stand_ = std::make_shared<ActionServer<hubero_ros_msgs::StandAction>>(
@@ -117,6 +146,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbStand, this, std::placeholders::_1),
 		false
 	);
+	as_stand_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_STAND));
 	as_stand_->start();
 
 	as_talk_ = std::make_shared<ActionServer<hubero_ros_msgs::TalkAction>>(
@@ -125,6 +155,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbTalk, this, std::placeholders::_1),
 		false
 	);
+	as_talk_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_TALK));
 	as_talk_->start();
 
 	as_talk_object_ = std::make_shared<ActionServer<hubero_ros_msgs::TalkObjectAction>>(
@@ -133,6 +164,7 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbTalkObject, this, std::placeholders::_1),
 		false
 	);
+	as_talk_object_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_TALK));
 	as_talk_object_->start();
 
 	as_teleop_ = std::make_shared<ActionServer<hubero_ros_msgs::TeleopAction>>(
@@ -141,11 +173,26 @@ void TaskRequestRos::initialize(
 		std::bind(&TaskRequestRos::actionCbTeleop, this, std::placeholders::_1),
 		false
 	);
+	as_teleop_->registerPreemptCallback(std::bind(&TaskRequestRos::notifyTaskFeedbackEvent, this, TASK_TELEOP));
 	as_teleop_->start();
+
+	// bulk task request is served by a single action server, shared by all actors
+	std::lock_guard<std::mutex> lock(instances_mutex_);
+	instances_[actor_name_] = this;
+	if (as_request_tasks_ == nullptr) {
+		as_request_tasks_ = std::make_shared<ActionServer<hubero_ros_msgs::RequestTasksAction>>(
+			*node_ptr->getNodeHandlePtr(),
+			node_ptr->getTaskNamespaceName() + "/" + TaskRequestRos::BULK_TASK_REQUEST_NAME,
+			std::bind(&TaskRequestRos::actionCbRequestTasks, std::placeholders::_1),
+			false
+		);
+		as_request_tasks_->registerPreemptCallback(&TaskRequestRos::notifyRequestTasks);
+		as_request_tasks_->start();
+	}
 }
 
 /**
- * @note Use of tf_buffer_.transform will produce linking errors in packages that use task request library.
+ * @note Use of tf2_ros::Buffer::transform will produce linking errors in packages that use task request library.
  * Suggestions like this: https://answers.ros.org/question/261419/tf2-transformpose-in-c/ did not help
  */
 Vector3 TaskRequestRos::transformToWorldFrame(const Vector3& pos, const std::string& frame_id) const {
@@ -155,7 +202,7 @@ Vector3 TaskRequestRos::transformToWorldFrame(const Vector3& pos, const std::str
 }
 
 /**
- * @note Use of tf_buffer_.transform will produce linking errors in packages that use task request library
+ * @note Use of tf2_ros::Buffer::transform will produce linking errors in packages that use task request library
  */
 Pose3 TaskRequestRos::transformToWorldFrame(const Pose3& pose, const std::string& frame_id) const {
 	Pose3 tf_goal_to_world = computeTransformToWorld(pose, frame_id);
@@ -165,16 +212,18 @@ Pose3 TaskRequestRos::transformToWorldFrame(const Pose3& pose, const std::string
 
 Pose3 TaskRequestRos::computeTransformToWorld(const Pose3& pose, const std::string& frame_id) const {
 	Pose3 tf_goal_to_world;
-	try {
-		auto tf_goal_world_msg = tf_buffer_.lookupTransform(world_frame_name_, frame_id, ros::Time(0));
-		tf_goal_to_world = msgTfToPose(tf_goal_world_msg.transform);
-	} catch (tf2::TransformException& ex) {
+	if (tf_service_ptr_ == nullptr) {
+		return tf_goal_to_world;
+	}
+
+	std::string error;
+	if (!tf_service_ptr_->findTransform(frame_id, world_frame_name_, tf_goal_to_world, error)) {
 		HUBERO_LOG(
 			"[%s].[TaskRequestRos] Could not transform '%s' to '%s' - exception: '%s'\r\n",
 			actor_name_.c_str(),
 			world_frame_name_.c_str(),
 			frame_id.c_str(),
-			ex.what()
+			error.c_str()
 		);
 	}
 	return tf_goal_to_world;
@@ -284,6 +333,254 @@ void TaskRequestRos::actionCbTeleop(const hubero_ros_msgs::TeleopGoalConstPtr& g
 	);
 }
 
+void TaskRequestRos::actionCbRequestTasks(const hubero_ros_msgs::RequestTasksGoalConstPtr& goal) {
+	hubero_ros_msgs::RequestTasksResult result;
+	std::vector<BulkTaskEntry> entries;
+
+	if (!requestTasks(goal->tasks, entries, result.text)) {
+		if (entries.empty()) {
+			// goal was not valid, nothing was requested
+			for (const auto& task_rejected: goal->tasks) {
+				hubero_ros_msgs::TaskStatus status;
+				status.actor_name = task_rejected.actor_name;
+				status.task_name = task_rejected.task_name;
+				status.status = TASK_FEEDBACK_REJECTED;
+				result.statuses.push_back(status);
+			}
+		} else {
+			collectTasksStatus(entries, result.statuses);
+		}
+		as_request_tasks_->setAborted(result, result.text);
+		return;
+	}
+
+	// state changes of any task (and preempt requests) wake up the loop below
+	auto notifier_ptr = std::make_shared<TaskEventNotifier>();
+	for (const auto& entry: entries) {
+		entry.task_ptr->addFeedbackNotifier(notifier_ptr);
+	}
+	{
+		std::lock_guard<std::mutex> lock(instances_mutex_);
+		request_tasks_notifier_ = notifier_ptr;
+	}
+
+	// publish statuses of all tasks as a single feedback stream until each of them finishes
+	auto time_requested = std::chrono::steady_clock::now();
+	auto time_feedback = time_requested;
+	bool feedback_published = false;
+	hubero_ros_msgs::RequestTasksFeedback feedback;
+	std::vector<hubero_ros_msgs::TaskStatus> statuses;
+	// events are counted before the conditions are checked, so none occurring in the meantime is missed
+	uint64_t event = notifier_ptr->getEvent();
+	while (collectTasksStatus(entries, statuses)) {
+		auto time_now = std::chrono::steady_clock::now();
+		if (as_request_tasks_->isPreemptRequested() || !ros::ok()) {
+			abortTasks(entries);
+			collectTasksStatus(entries, result.statuses);
+			result.text = "Preempted";
+			as_request_tasks_->setPreempted(result, result.text);
+			HUBERO_LOG("[TaskRequestRos] Bulk task request preempted, aborting tasks\r\n");
+			return;
+		}
+
+		// tasks that are not accepted in time are aborted, others keep running
+		if (time_now - time_requested > TASK_PENDING_TIMEOUT) {
+			for (size_t i = 0; i < entries.size(); i++) {
+				if (statuses.at(i).status == TASK_FEEDBACK_PENDING) {
+					HUBERO_LOG(
+						"[%s].[TaskRequestRos] Pending status of task (type %d) is staying for too long, aborting task\r\n",
+						entries.at(i).actor_name.c_str(),
+						entries.at(i).task_type
+					);
+					entries.at(i).task_ptr->abort();
+				}
+			}
+		}
+
+		bool statuses_changed = !feedback_published || statuses.size() != feedback.statuses.size();
+		for (size_t i = 0; !statuses_changed && i < statuses.size(); i++) {
+			statuses_changed = statuses.at(i).status != feedback.statuses.at(i).status;
+		}
+		if (statuses_changed || time_now - time_feedback >= BULK_TASK_FEEDBACK_PERIOD) {
+			feedback.statuses = statuses;
+			as_request_tasks_->publishFeedback(feedback);
+			time_feedback = time_now;
+			feedback_published = true;
+		}
+
+		// woken up by the state change of any task or the preempt request
+		notifier_ptr->wait(event, BULK_TASK_FEEDBACK_PERIOD);
+		event = notifier_ptr->getEvent();
+	}
+
+	result.statuses = statuses;
+	for (const auto& status: statuses) {
+		if (status.status != TASK_FEEDBACK_SUCCEEDED) {
+			result.text = "Task '" + status.task_name + "' of actor '" + status.actor_name + "' did not succeed";
+			as_request_tasks_->setAborted(result, result.text);
+			HUBERO_LOG("[TaskRequestRos] Finishing bulk task request with ABORTED state: %s\r\n", result.text.c_str());
+			return;
+		}
+	}
+	as_request_tasks_->setSucceeded(result);
+	HUBERO_LOG("[TaskRequestRos] Finishing bulk task request with SUCCEEDED state\r\n");
+}
+
+void TaskRequestRos::notifyRequestTasks() {
+	std::lock_guard<std::mutex> lock(instances_mutex_);
+	auto notifier_ptr = request_tasks_notifier_.lock();
+	if (notifier_ptr != nullptr) {
+		notifier_ptr->notify();
+	}
+}
+
+bool TaskRequestRos::requestTasks(
+	const std::vector<hubero_ros_msgs::TaskGoal>& tasks,
+	std::vector<BulkTaskEntry>& entries,
+	std::string& error
+) {
+	entries.clear();
+	error.clear();
+
+	if (tasks.empty()) {
+		error = "Goal does not contain any task";
+		return false;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(instances_mutex_);
+
+		// validate the whole goal first, so either all tasks are requested or none of them
+		std::set<std::string> actors;
+		for (const auto& task: tasks) {
+			auto it = instances_.find(task.actor_name);
+			if (it == instances_.end()) {
+				error = "Unknown actor '" + task.actor_name + "'";
+			} else if (!actors.insert(task.actor_name).second) {
+				error = "Actor '" + task.actor_name + "' is listed more than once";
+			}
+			BulkTaskEntry entry;
+			entry.actor_name = task.actor_name;
+			entry.task_name = task.task_name;
+			entry.task_type = TaskRequestBase::getTaskType(task.task_name);
+			if (error.empty()) {
+				entry.task_ptr = it->second->findTask(entry.task_type);
+				if (entry.task_ptr == nullptr) {
+					error = "Task '" + task.task_name + "' is not defined for actor '" + task.actor_name + "'";
+				}
+			}
+			if (!error.empty()) {
+				entries.clear();
+				HUBERO_LOG("[TaskRequestRos] Bulk task request rejected: %s\r\n", error.c_str());
+				return false;
+			}
+			entries.push_back(entry);
+		}
+	}
+
+	// make sure that current goals of the same tasks are aborted (see 'actionCbHandler'); all of them are aborted
+	// first, so actors process the aborts concurrently, and nobody waits for them with the instances locked
+	std::vector<bool> aborted(entries.size(), false);
+	for (size_t i = 0; i < entries.size(); i++) {
+		auto feedback_type = entries.at(i).task_ptr->getTaskFeedbackType();
+		if (feedback_type == TASK_FEEDBACK_PENDING || feedback_type == TASK_FEEDBACK_ACTIVE) {
+			entries.at(i).task_ptr->abort();
+			aborted.at(i) = true;
+		}
+	}
+	for (size_t i = 0; i < entries.size(); i++) {
+		if (aborted.at(i)) {
+			entries.at(i).task_ptr->waitForFeedbackChange(TASK_FEEDBACK_ABORTED, TASK_TRANSITION_TIMEOUT);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(instances_mutex_);
+
+		// request all tasks back-to-back; actors are looked up again as they might have been removed meanwhile
+		for (size_t i = 0; i < entries.size(); i++) {
+			const auto& task = tasks.at(i);
+			auto it = instances_.find(task.actor_name);
+			if (it == instances_.end() || it->second->findTask(entries.at(i).task_type) != entries.at(i).task_ptr) {
+				error = "Actor '" + task.actor_name + "' is no longer available";
+				break;
+			}
+			Pose3 goal_pose(msgPointToIgnVector(task.pos), Quaternion(0.0, 0.0, task.yaw));
+			Pose3 goal_world_pose = task.frame.empty()
+				? goal_pose
+				: it->second->transformToWorldFrame(goal_pose, task.frame);
+			bool request_ok = it->second->requestTaskGoal(entries.at(i).task_type, task, goal_world_pose);
+			if (!request_ok || entries.at(i).task_ptr->getTaskFeedbackType() == TASK_FEEDBACK_REJECTED) {
+				error = "Task '" + task.task_name + "' of actor '" + task.actor_name + "' rejected after initial check";
+				break;
+			}
+		}
+	}
+
+	if (!error.empty()) {
+		// withdraw tasks requested so far
+		abortTasks(entries);
+		HUBERO_LOG("[TaskRequestRos] Bulk task request aborted: %s\r\n", error.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool TaskRequestRos::collectTasksStatus(
+	const std::vector<BulkTaskEntry>& entries,
+	std::vector<hubero_ros_msgs::TaskStatus>& statuses
+) {
+	bool running = false;
+	statuses.resize(entries.size());
+	for (size_t i = 0; i < entries.size(); i++) {
+		statuses.at(i).actor_name = entries.at(i).actor_name;
+		statuses.at(i).task_name = entries.at(i).task_name;
+		TaskFeedbackType feedback_type = entries.at(i).task_ptr->getTaskFeedbackType();
+		statuses.at(i).status = feedback_type;
+		running = running || feedback_type == TASK_FEEDBACK_PENDING || feedback_type == TASK_FEEDBACK_ACTIVE;
+	}
+	return running;
+}
+
+void TaskRequestRos::abortTasks(const std::vector<BulkTaskEntry>& entries) {
+	for (const auto& entry: entries) {
+		auto feedback_type = entry.task_ptr->getTaskFeedbackType();
+		if (feedback_type == TASK_FEEDBACK_PENDING || feedback_type == TASK_FEEDBACK_ACTIVE) {
+			entry.task_ptr->abort();
+		}
+	}
+}
+
+bool TaskRequestRos::requestTaskGoal(
+	TaskType task_type,
+	const hubero_ros_msgs::TaskGoal& goal,
+	const Pose3& goal_world_pose
+) {
+	switch (task_type) {
+		case TASK_STAND:
+		case TASK_MOVE_AROUND:
+		case TASK_TELEOP:
+			return request(task_type);
+		case TASK_MOVE_TO_GOAL:
+		case TASK_RUN:
+		case TASK_TALK:
+			return request(task_type, goal_world_pose);
+		case TASK_LIE_DOWN:
+		case TASK_SIT_DOWN:
+			return request(task_type, goal_world_pose.Pos(), goal_world_pose.Rot().Yaw());
+		case TASK_FOLLOW_OBJECT:
+			return request(task_type, goal.object_name);
+		default:
+			HUBERO_LOG(
+				"[%s].[TaskRequestRos] Task '%s' (type %d) cannot be requested in bulk\r\n",
+				actor_name_.c_str(),
+				goal.task_name.c_str(),
+				task_type
+			);
+			return false;
+	}
+}
+
 bool TaskRequestRos::requestActionGoal(const hubero_ros_msgs::FollowObjectGoalConstPtr& goal) {
 	return request(TASK_FOLLOW_OBJECT, goal->object_name);
 }
@@ -2,13 +2,20 @@
 #include <hubero_ros/task_request_ros.h>
 #include <hubero_ros/utils/converter.h>
 
+#include <chrono>
 #include <iostream>
+#include <thread>
 
 namespace hubero {
 
+// static member definitions
+const double TaskRequestRosApi::CONNECTION_CHECK_PERIOD = 0.1;
+const double TaskRequestRosApi::CONNECTION_LOG_PERIOD = 5.0;
+
 TaskRequestRosApi::TaskRequestRosApi(const std::string& actor_name):
-	node_ptr_(std::make_shared<Node>("task_request_ros_api_node")
-) {
+	node_ptr_(std::make_shared<Node>("task_request_ros_api_node")),
+	connection_aborted_(false)
+{
 	// assignment - init list does not support string reference copying
 	actor_name_ = actor_name;
 
@@ -110,6 +117,73 @@ TaskRequestRosApi::TaskRequestRosApi(const std::string& actor_name):
 		hubero_ros_msgs::TeleopActionResultConstPtr>
 		>(node_ptr_, actor_task_ns + TaskRequestBase::getTaskName(TASK_TELEOP)
 	);
+
+	addConnection(ac_follow_object_ptr_);
+	addConnection(ac_lie_down_ptr_);
+	addConnection(ac_lie_down_object_ptr_);
+	addConnection(ac_move_around_ptr_);
+	addConnection(ac_move_to_goal_ptr_);
+	addConnection(ac_move_to_object_ptr_);
+	addConnection(ac_run_ptr_);
+	addConnection(ac_sit_down_ptr_);
+	addConnection(ac_sit_down_object_ptr_);
+	addConnection(ac_stand_ptr_);
+	addConnection(ac_talk_ptr_);
+	addConnection(ac_talk_object_ptr_);
+	addConnection(ac_teleop_ptr_);
+
+	ready_future_ = std::async(std::launch::async, &TaskRequestRosApi::connect, this).share();
+}
+
+TaskRequestRosApi::~TaskRequestRosApi() {
+	connection_aborted_ = true;
+	if (ready_future_.valid()) {
+		ready_future_.wait();
+	}
+}
+
+bool TaskRequestRosApi::waitForReady(double timeout) const {
+	if (!ready_future_.valid()) {
+		return false;
+	}
+	if (timeout < 0.0) {
+		return ready_future_.get();
+	}
+	auto status = ready_future_.wait_for(std::chrono::duration<double>(timeout));
+	return status == std::future_status::ready && ready_future_.get();
+}
+
+bool TaskRequestRosApi::connect() {
+	auto time_log = std::chrono::steady_clock::now();
+	size_t connected = 0;
+	while (connected < connections_.size()) {
+		if (!ros::ok() || connection_aborted_) {
+			ROS_ERROR(
+				"[TaskRequestRosApi] %s: connection aborted, %lu of %lu action servers connected",
+				actor_name_.c_str(),
+				connected,
+				connections_.size()
+			);
+			return false;
+		}
+
+		// servers that came up in previous iterations are not checked again
+		while (connected < connections_.size() && connections_.at(connected).second()) {
+			connected++;
+		}
+		if (connected == connections_.size()) {
+			break;
+		}
+
+		auto now = std::chrono::steady_clock::now();
+		if (std::chrono::duration<double>(now - time_log).count() >= CONNECTION_LOG_PERIOD) {
+			ROS_INFO("%s: Waiting for the action server to come up", connections_.at(connected).first.c_str());
+			time_log = now;
+		}
+		std::this_thread::sleep_for(std::chrono::duration<double>(CONNECTION_CHECK_PERIOD));
+	}
+	ROS_INFO("[TaskRequestRosApi] %s: all %lu action servers started!", actor_name_.c_str(), connections_.size());
+	return true;
 }
 
 bool TaskRequestRosApi::followObject(const std::string& object_name) {
@@ -0,0 +1,70 @@
+#include <hubero_ros/utils/publication_governor.h>
+
+#include <algorithm>
+
+namespace hubero {
+
+PublicationGovernor::PublicationGovernor(const Parameters& params) {
+	setParameters(params);
+	reset();
+}
+
+// static
+PublicationGovernor::Parameters PublicationGovernor::loadParameters(
+	const std::string& param_ns,
+	const Parameters& params_default
+) {
+	// helps loading params (looks from a global scope)
+	ros::NodeHandle nh;
+	Parameters params;
+
+	std::string param_rate;
+	nh.searchParam(param_ns + "/rate", param_rate);
+	nh.param(param_rate, params.rate, params_default.rate);
+
+	std::string param_decimation;
+	nh.searchParam(param_ns + "/decimation", param_decimation);
+	nh.param(param_decimation, params.decimation, params_default.decimation);
+
+	std::string param_lazy;
+	nh.searchParam(param_ns + "/lazy", param_lazy);
+	nh.param(param_lazy, params.lazy, params_default.lazy);
+	return params;
+}
+
+void PublicationGovernor::setParameters(const Parameters& params) {
+	params_ = params;
+	params_.decimation = std::max(params_.decimation, 1);
+	period_ = ros::Duration(params_.rate > 0.0 ? (1.0 / params_.rate) : 0.0);
+}
+
+bool PublicationGovernor::isPublishRequired(const ros::Time& stamp, uint32_t subscribers_num) {
+	if (params_.lazy && subscribers_num == 0) {
+		return false;
+	}
+
+	// decimation applies to the input samples, the rate limit - to the output
+	if (++samples_skipped_ < params_.decimation) {
+		return false;
+	}
+
+	// time going backwards means that the simulation was reset
+	bool period_elapsed = !published_ || stamp < stamp_last_ || (stamp - stamp_last_) >= period_;
+	if (!period_elapsed) {
+		return false;
+	}
+
+	published_ = true;
+	stamp_last_ = stamp;
+	samples_skipped_ = 0;
+	return true;
+}
+
+void PublicationGovernor::reset() {
+	published_ = false;
+	stamp_last_ = ros::Time();
+	// the first sample is published without decimation
+	samples_skipped_ = params_.decimation - 1;
+}
+
+} // namespace hubero
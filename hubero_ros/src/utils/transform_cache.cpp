@@ -0,0 +1,149 @@
+#include <hubero_ros/utils/transform_cache.h>
+#include <hubero_ros/utils/converter.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace hubero {
+
+const int TransformCache::CHAIN_LENGTH_MAX = 64;
+
+TransformCache::TransformCache(): snapshot_ptr_(std::make_shared<const Snapshot>()) {}
+
+void TransformCache::update(const tf2_msgs::TFMessage& msg, bool is_static) {
+	for (const auto& tf: msg.transforms) {
+		updateEdge(tf.header.frame_id, tf.child_frame_id, msgTfToPose(tf.transform), is_static, tf.header.stamp);
+	}
+}
+
+bool TransformCache::find(const std::string& frame_source, const std::string& frame_target, Pose3& transform) {
+	FramePair key(stripSlash(frame_source), stripSlash(frame_target));
+
+	// hot path - lock-free
+	auto snapshot_ptr = std::atomic_load(&snapshot_ptr_);
+	auto it = snapshot_ptr->find(key);
+	if (it != snapshot_ptr->end()) {
+		transform = it->second.transform;
+		return true;
+	}
+
+	const std::lock_guard<std::mutex> lock(mutex_);
+	auto ancestors_source = collectStaticAncestors(key.first);
+	auto ancestors_target = collectStaticAncestors(key.second);
+
+	// find the closest common ancestor
+	for (size_t i = 0; i < ancestors_source.size(); i++) {
+		for (size_t j = 0; j < ancestors_target.size(); j++) {
+			if (ancestors_source[i].first != ancestors_target[j].first) {
+				continue;
+			}
+			// source -> ancestor -> target
+			Resolved resolved;
+			resolved.transform = ancestors_source[i].second - ancestors_target[j].second;
+			// each frame below the common ancestor is a child of an edge of the chain
+			for (size_t k = 0; k < i; k++) {
+				resolved.edges.push_back(ancestors_source[k].first);
+			}
+			for (size_t k = 0; k < j; k++) {
+				resolved.edges.push_back(ancestors_target[k].first);
+			}
+			transform = resolved.transform;
+
+			// snapshot may have been replaced in the meantime, copy the newest one
+			auto snapshot_new_ptr = std::make_shared<Snapshot>(*std::atomic_load(&snapshot_ptr_));
+			(*snapshot_new_ptr)[key] = resolved;
+			std::atomic_store(&snapshot_ptr_, std::shared_ptr<const Snapshot>(snapshot_new_ptr));
+			return true;
+		}
+	}
+	return false;
+}
+
+void TransformCache::updateEdge(
+	const std::string& frame_parent,
+	const std::string& frame_child,
+	const Pose3& transform,
+	bool is_static,
+	const ros::Time& stamp
+) {
+	const std::lock_guard<std::mutex> lock(mutex_);
+	auto parent = stripSlash(frame_parent);
+	auto child = stripSlash(frame_child);
+
+	auto it = edges_.find(child);
+	if (it == edges_.end()) {
+		// new edge does not affect chains that were resolved before
+		edges_.insert({child, Edge {parent, transform, stamp, false}});
+		return;
+	}
+
+	Edge& edge = it->second;
+	// stale or reordered transform must not overwrite the newer one
+	if (stamp < edge.stamp) {
+		return;
+	}
+	edge.stamp = stamp;
+	if (edge.parent == parent && !isDifferent(edge.transform, transform)) {
+		return;
+	}
+	bool was_static = !edge.dynamic;
+	edge.parent = parent;
+	edge.transform = transform;
+	edge.dynamic = !is_static;
+	// only static edges were used to resolve transforms
+	if (was_static) {
+		invalidateEdge(child);
+	}
+}
+
+void TransformCache::invalidateEdge(const std::string& frame_child) {
+	auto snapshot_ptr = std::atomic_load(&snapshot_ptr_);
+	auto snapshot_new_ptr = std::make_shared<Snapshot>();
+	for (const auto& entry: *snapshot_ptr) {
+		const auto& edges = entry.second.edges;
+		if (std::find(edges.begin(), edges.end(), frame_child) == edges.end()) {
+			snapshot_new_ptr->insert(entry);
+		}
+	}
+	if (snapshot_new_ptr->size() != snapshot_ptr->size()) {
+		std::atomic_store(&snapshot_ptr_, std::shared_ptr<const Snapshot>(snapshot_new_ptr));
+	}
+}
+
+size_t TransformCache::getCachedNum() const {
+	return std::atomic_load(&snapshot_ptr_)->size();
+}
+
+std::vector<std::pair<std::string, Pose3>> TransformCache::collectStaticAncestors(const std::string& frame) const {
+	// the frame itself is the first "ancestor"
+	std::vector<std::pair<std::string, Pose3>> ancestors {{frame, Pose3()}};
+	for (int i = 0; i < CHAIN_LENGTH_MAX; i++) {
+		auto it = edges_.find(ancestors.back().first);
+		if (it == edges_.end() || it->second.dynamic) {
+			break;
+		}
+		// pose expressed in the child frame + child in parent = pose expressed in the parent frame
+		ancestors.push_back({it->second.parent, ancestors.back().second + it->second.transform});
+	}
+	return ancestors;
+}
+
+// static
+std::string TransformCache::stripSlash(const std::string& frame) {
+	if (!frame.empty() && frame.front() == '/') {
+		return frame.substr(1);
+	}
+	return frame;
+}
+
+// static
+bool TransformCache::isDifferent(const Pose3& a, const Pose3& b) {
+	const double EPS = 1e-09;
+	return (a.Pos() - b.Pos()).Length() > EPS
+		|| std::abs(a.Rot().W() - b.Rot().W()) > EPS
+		|| std::abs(a.Rot().X() - b.Rot().X()) > EPS
+		|| std::abs(a.Rot().Y() - b.Rot().Y()) > EPS
+		|| std::abs(a.Rot().Z() - b.Rot().Z()) > EPS;
+}
+
+} // namespace hubero
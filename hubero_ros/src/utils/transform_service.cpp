@@ -0,0 +1,104 @@
+#include <hubero_ros/utils/transform_service.h>
+#include <hubero_ros/utils/converter.h>
+
+namespace hubero {
+
+bool TransformService::service_started_ = false;
+std::mutex TransformService::mutex_;
+std::shared_ptr<tf2_ros::Buffer> TransformService::buffer_ptr_;
+std::shared_ptr<ros::CallbackQueue> TransformService::queue_ptr_;
+std::shared_ptr<ros::AsyncSpinner> TransformService::spinner_ptr_;
+ros::Subscriber TransformService::sub_tf_;
+ros::Subscriber TransformService::sub_tf_static_;
+std::shared_ptr<TransformCache> TransformService::cache_ptr_;
+std::shared_ptr<TransformBatch> TransformService::batch_ptr_;
+ros::Publisher TransformService::pub_tf_;
+
+TransformService::TransformService(std::shared_ptr<ros::NodeHandle> nh_ptr) {
+	const std::lock_guard<std::mutex> lock(TransformService::mutex_);
+	if (TransformService::service_started_) {
+		return;
+	}
+
+	TransformService::buffer_ptr_ = std::make_shared<tf2_ros::Buffer>();
+	TransformService::cache_ptr_ = std::make_shared<TransformCache>();
+
+	// TF topics are spun in a separate thread with their own callback queue (same as tf2_ros::TransformListener)
+	TransformService::queue_ptr_ = std::make_shared<ros::CallbackQueue>();
+	ros::NodeHandle nh_tf(*nh_ptr);
+	nh_tf.setCallbackQueue(TransformService::queue_ptr_.get());
+	TransformService::sub_tf_ = nh_tf.subscribe("/tf", 100, &TransformService::callbackTf);
+	TransformService::sub_tf_static_ = nh_tf.subscribe("/tf_static", 100, &TransformService::callbackTfStatic);
+	TransformService::spinner_ptr_ = std::make_shared<ros::AsyncSpinner>(1, TransformService::queue_ptr_.get());
+	TransformService::spinner_ptr_->start();
+
+	// same topic and queue size as tf2_ros::TransformBroadcaster uses
+	TransformService::pub_tf_ = nh_ptr->advertise<tf2_msgs::TFMessage>("/tf", 100);
+	TransformService::batch_ptr_ = std::make_shared<TransformBatch>(
+		[](const tf2_msgs::TFMessage& msg) {
+			TransformService::pub_tf_.publish(msg);
+		}
+	);
+
+	// flag to create only 1 listener for all actors
+	TransformService::service_started_ = true;
+}
+
+bool TransformService::findTransform(
+	const std::string& frame_source,
+	const std::string& frame_target,
+	Pose3& transform,
+	std::string& error
+) const {
+	if (TransformService::cache_ptr_->find(frame_source, frame_target, transform)) {
+		return true;
+	}
+
+	try {
+		auto tf_msg = TransformService::buffer_ptr_->lookupTransform(frame_target, frame_source, ros::Time(0));
+		transform = msgTfToPose(tf_msg.transform);
+		return true;
+	} catch (tf2::TransformException& ex) {
+		error = ex.what();
+	}
+	return false;
+}
+
+void TransformService::callbackTf(const ros::MessageEvent<tf2_msgs::TFMessage const>& event) {
+	processMessage(event, false);
+}
+
+void TransformService::callbackTfStatic(const ros::MessageEvent<tf2_msgs::TFMessage const>& event) {
+	processMessage(event, true);
+}
+
+void TransformService::processMessage(const ros::MessageEvent<tf2_msgs::TFMessage const>& event, bool is_static) {
+	const auto& msg = *event.getConstMessage();
+	std::string authority = event.getPublisherName();
+	for (const auto& tf: msg.transforms) {
+		try {
+			TransformService::buffer_ptr_->setTransform(tf, authority, is_static);
+		} catch (tf2::TransformException& ex) {
+			ROS_ERROR(
+				"[TransformService] Failure to set received transform from %s to %s with error: %s",
+				tf.child_frame_id.c_str(),
+				tf.header.frame_id.c_str(),
+				ex.what()
+			);
+		}
+	}
+	TransformService::cache_ptr_->update(msg, is_static);
+}
+
+void TransformService::sendTransforms(const std::vector<geometry_msgs::TransformStamped>& transforms) {
+	TransformService::batch_ptr_->add(transforms);
+}
+
+void TransformService::flush() {
+	if (TransformService::batch_ptr_ == nullptr) {
+		return;
+	}
+	TransformService::batch_ptr_->flush();
+}
+
+} // namespace hubero
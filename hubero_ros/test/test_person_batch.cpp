@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <hubero_ros/utils/person_batch.h>
+
+using namespace hubero;
+
+static hubero_ros_msgs::Person createPerson(const std::string& name, double stamp, const std::string& frame = "world") {
+	hubero_ros_msgs::Person person;
+	person.header.stamp = ros::Time(stamp);
+	person.header.frame_id = frame;
+	person.object_id = name;
+	return person;
+}
+
+TEST(HuberoRosPersonBatch, singleMessagePerStep) {
+	std::vector<hubero_ros_msgs::PersonArray> published;
+	PersonBatch batch([&published](const hubero_ros_msgs::PersonArray& msg) { published.push_back(msg); });
+
+	// 3 actors within the first step
+	batch.add(createPerson("actor1", 1.0));
+	batch.add(createPerson("actor2", 1.0));
+	batch.add(createPerson("actor3", 1.0));
+	EXPECT_EQ(published.size(), 0);
+	EXPECT_EQ(batch.getSize(), 3);
+
+	// next step begins
+	batch.add(createPerson("actor1", 1.1));
+	ASSERT_EQ(published.size(), 1);
+	ASSERT_EQ(published.front().people.size(), 3);
+	EXPECT_EQ(published.front().header.stamp, ros::Time(1.0));
+	EXPECT_EQ(published.front().header.frame_id, "world");
+	EXPECT_EQ(published.front().people.at(2).object_id, "actor3");
+	EXPECT_EQ(batch.getSize(), 1);
+
+	// same stamp, but the actor is repeated - also a new step
+	batch.add(createPerson("actor2", 1.1));
+	batch.add(createPerson("actor1", 1.1));
+	ASSERT_EQ(published.size(), 2);
+	EXPECT_EQ(published.back().people.size(), 2);
+
+	// people expressed in different frames are not mixed
+	batch.add(createPerson("actor2", 1.1, "map"));
+	ASSERT_EQ(published.size(), 3);
+	EXPECT_EQ(published.back().people.size(), 1);
+
+	batch.flush();
+	ASSERT_EQ(published.size(), 4);
+	EXPECT_EQ(published.back().header.frame_id, "map");
+	EXPECT_EQ(batch.getSize(), 0);
+
+	// nothing to publish
+	batch.flush();
+	EXPECT_EQ(published.size(), 4);
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <hubero_ros/utils/publication_governor.h>
+
+using namespace hubero;
+
+/// Evaluates the governor at the given rate of updates, returns the number of publications
+static int simulate(PublicationGovernor& governor, double duration, double dt, uint32_t subscribers_num = 1) {
+	int publications = 0;
+	// integer steps avoid accumulation of floating point errors
+	for (int i = 0; i * dt < duration; i++) {
+		if (governor.isPublishRequired(ros::Time(100.0 + i * dt), subscribers_num)) {
+			publications++;
+		}
+	}
+	return publications;
+}
+
+TEST(HuberoRosPublicationGovernor, rateAndDecimation) {
+	// not limited
+	PublicationGovernor governor;
+	EXPECT_EQ(simulate(governor, 1.0, 0.001), 1000);
+
+	// rate limited to 50 Hz
+	governor = PublicationGovernor(PublicationGovernor::Parameters(50.0));
+	EXPECT_NEAR(simulate(governor, 1.0, 0.001), 50, 1);
+
+	// each 4th sample
+	governor = PublicationGovernor(PublicationGovernor::Parameters(0.0, 4));
+	EXPECT_EQ(simulate(governor, 1.0, 0.001), 250);
+
+	// both applied, the more restrictive one dominates
+	governor = PublicationGovernor(PublicationGovernor::Parameters(10.0, 2));
+	EXPECT_NEAR(simulate(governor, 1.0, 0.001), 10, 1);
+	governor = PublicationGovernor(PublicationGovernor::Parameters(100.0, 40));
+	EXPECT_EQ(simulate(governor, 1.0, 0.001), 25);
+}
+
+TEST(HuberoRosPublicationGovernor, subscribersAndReset) {
+	PublicationGovernor governor(PublicationGovernor::Parameters(10.0, 1, true));
+	EXPECT_EQ(simulate(governor, 1.0, 0.001, 0), 0);
+
+	PublicationGovernor governor_eager(PublicationGovernor::Parameters(10.0, 1, false));
+	EXPECT_NEAR(simulate(governor_eager, 1.0, 0.001, 0), 10, 1);
+
+	// time going backwards is treated as a simulation reset
+	ASSERT_TRUE(governor.isPublishRequired(ros::Time(50.0)));
+	EXPECT_FALSE(governor.isPublishRequired(ros::Time(50.05)));
+	EXPECT_TRUE(governor.isPublishRequired(ros::Time(10.0)));
+
+	governor.reset();
+	EXPECT_TRUE(governor.isPublishRequired(ros::Time(10.01)));
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
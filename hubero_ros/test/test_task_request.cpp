@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 #include <hubero_ros/task_request_ros.h>
 
+#include <actionlib/client/simple_action_client.h>
 #include <tf2_ros/static_transform_broadcaster.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 using namespace hubero;
 
 TEST(HuberoTaskRequestRos, taskRequest) {
@@ -67,6 +72,302 @@ TEST(HuberoTaskRequestRos, transformToWorld) {
     ASSERT_NEAR(goal_world2.Rot().Yaw(), 0.0, 1e-03);
 }
 
+/**
+ * @brief Simulates processing of the task by the actor's FSM: activates requested task and terminates aborted one
+ */
+class ActorTaskSimulator {
+public:
+    ActorTaskSimulator(std::shared_ptr<TaskBase> task_ptr, bool terminate_aborted = true):
+        task_ptr_(task_ptr),
+        terminate_aborted_(terminate_aborted),
+        running_(true),
+        aborts_num_(0),
+        thread_(&ActorTaskSimulator::run, this) {}
+
+    ~ActorTaskSimulator() {
+        running_ = false;
+        thread_.join();
+    }
+
+    int getAbortsNum() const {
+        return aborts_num_;
+    }
+
+protected:
+    void run() {
+        while (running_) {
+            if (task_ptr_->isRequested()) {
+                task_ptr_->activate();
+            } else if (terminate_aborted_ && task_ptr_->getTaskFeedbackType() == TASK_FEEDBACK_ABORTED) {
+                aborts_num_++;
+                task_ptr_->terminate();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::shared_ptr<TaskBase> task_ptr_;
+    bool terminate_aborted_;
+    std::atomic<bool> running_;
+    std::atomic<int> aborts_num_;
+    std::thread thread_;
+};
+
+/// @brief Returns name of the action that allows to request @ref task from @ref actor_name
+static std::string getActionName(const std::string& actor_name, TaskType task) {
+    return "/" + Node::getNamespaceName() + "/" + actor_name + "/" + Node::getTaskNamespaceName()
+        + "/" + TaskRequestBase::getTaskName(task);
+}
+
+/// @brief Waits until the goal tracked by @ref client reaches the @ref state
+template <typename Taction>
+static bool waitForGoalState(
+    actionlib::SimpleActionClient<Taction>& client,
+    actionlib::SimpleClientGoalState::StateEnum state,
+    const std::chrono::milliseconds& timeout
+) {
+    auto time_end = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < time_end) {
+        if (client.getState() == state) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+/**
+ * @brief Goal stays pending until the actor activates the task and succeeds once the task is finished
+ * @details Requires running `roscore`
+ */
+TEST(HuberoTaskRequestRos, actionGoalLifecycle) {
+    auto node = std::make_shared<Node>("task_ros");
+    ros::AsyncSpinner spinner(2);
+    spinner.start();
+
+    auto task = std::make_shared<TaskBase>(TASK_STAND);
+    TaskRequestRos task_request;
+    task_request.addTask(TASK_STAND, task);
+    task_request.initialize(node, "actor_lifecycle", "world");
+
+    actionlib::SimpleActionClient<hubero_ros_msgs::StandAction> client(getActionName("actor_lifecycle", TASK_STAND));
+    ASSERT_TRUE(client.waitForServer(ros::Duration(5.0)));
+
+    ActorTaskSimulator actor(task);
+    client.sendGoal(hubero_ros_msgs::StandGoal());
+    ASSERT_TRUE(waitForGoalState(client, actionlib::SimpleClientGoalState::ACTIVE, TaskRequestRos::TASK_PENDING_TIMEOUT));
+    ASSERT_TRUE(task->isActive());
+
+    task->finish();
+    ASSERT_TRUE(client.waitForResult(ros::Duration(5.0)));
+    ASSERT_EQ(client.getState(), actionlib::SimpleClientGoalState::SUCCEEDED);
+    ASSERT_EQ(actor.getAbortsNum(), 0);
+}
+
+/**
+ * @brief New goal of the same action aborts the current task, waits for the actor to process it and
+ * activates the task with the new goal
+ * @details Requires running `roscore`
+ */
+TEST(HuberoTaskRequestRos, actionNewGoal) {
+    auto node = std::make_shared<Node>("task_ros");
+    ros::AsyncSpinner spinner(2);
+    spinner.start();
+
+    auto task = std::make_shared<TaskBase>(TASK_STAND);
+    TaskRequestRos task_request;
+    task_request.addTask(TASK_STAND, task);
+    task_request.initialize(node, "actor_new_goal", "world");
+
+    actionlib::SimpleActionClient<hubero_ros_msgs::StandAction> client(getActionName("actor_new_goal", TASK_STAND));
+    ASSERT_TRUE(client.waitForServer(ros::Duration(5.0)));
+
+    ActorTaskSimulator actor(task);
+    client.sendGoal(hubero_ros_msgs::StandGoal());
+    ASSERT_TRUE(waitForGoalState(client, actionlib::SimpleClientGoalState::ACTIVE, TaskRequestRos::TASK_PENDING_TIMEOUT));
+
+    // replaces the previous goal
+    client.sendGoal(hubero_ros_msgs::StandGoal());
+    ASSERT_TRUE(waitForGoalState(client, actionlib::SimpleClientGoalState::ACTIVE, TaskRequestRos::TASK_PENDING_TIMEOUT));
+    // the new goal is processed once the actor handled the abort of the previous one
+    auto time_end = std::chrono::steady_clock::now() + TaskRequestRos::TASK_PENDING_TIMEOUT;
+    while (!task->isActive() && std::chrono::steady_clock::now() < time_end) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(task->isActive());
+    ASSERT_EQ(actor.getAbortsNum(), 1);
+
+    task->finish();
+    ASSERT_TRUE(client.waitForResult(ros::Duration(5.0)));
+    ASSERT_EQ(client.getState(), actionlib::SimpleClientGoalState::SUCCEEDED);
+}
+
+/**
+ * @brief Cancelling the goal aborts the task immediately, without waiting for the next feedback period
+ * @details Requires running `roscore`
+ */
+TEST(HuberoTaskRequestRos, actionCancel) {
+    auto node = std::make_shared<Node>("task_ros");
+    ros::AsyncSpinner spinner(2);
+    spinner.start();
+
+    auto task = std::make_shared<TaskBase>(TASK_STAND);
+    TaskRequestRos task_request;
+    task_request.addTask(TASK_STAND, task);
+    task_request.initialize(node, "actor_cancel", "world");
+
+    actionlib::SimpleActionClient<hubero_ros_msgs::StandAction> client(getActionName("actor_cancel", TASK_STAND));
+    ASSERT_TRUE(client.waitForServer(ros::Duration(5.0)));
+
+    // aborted task is left as it is, so the final state is deterministic
+    ActorTaskSimulator actor(task, false);
+    client.sendGoal(hubero_ros_msgs::StandGoal());
+    ASSERT_TRUE(waitForGoalState(client, actionlib::SimpleClientGoalState::ACTIVE, TaskRequestRos::TASK_PENDING_TIMEOUT));
+
+    auto time_cancel = std::chrono::steady_clock::now();
+    client.cancelGoal();
+    ASSERT_TRUE(client.waitForResult(ros::Duration(5.0)));
+    auto cancel_duration = std::chrono::steady_clock::now() - time_cancel;
+    ASSERT_EQ(client.getState(), actionlib::SimpleClientGoalState::ABORTED);
+    ASSERT_EQ(task->getTaskFeedbackType(), TASK_FEEDBACK_ABORTED);
+    ASSERT_LT(cancel_duration, TaskRequestRos::TASK_FEEDBACK_PERIOD);
+}
+
+/**
+ * @brief Exposes the logic of the bulk task request
+ */
+class BulkTaskRequestRos: public TaskRequestRos {
+public:
+    using TaskRequestRos::BulkTaskEntry;
+    using TaskRequestRos::requestTasks;
+};
+
+/**
+ * @brief Task that expects a goal pose in the request
+ */
+class TaskWithGoal: public TaskBase {
+public:
+    TaskWithGoal(TaskType task): TaskBase(task) {
+        task_args_num_ = 1;
+    }
+};
+
+static hubero_ros_msgs::TaskGoal createTaskGoal(const std::string& actor_name, TaskType task) {
+    hubero_ros_msgs::TaskGoal goal;
+    goal.actor_name = actor_name;
+    goal.task_name = TaskRequestBase::getTaskName(task);
+    return goal;
+}
+
+/**
+ * @brief Bulk request is validated as a whole, nothing is requested if any entry is invalid
+ * @details Requires running `roscore`
+ */
+TEST(HuberoTaskRequestRos, bulkRequestValidation) {
+    auto node = std::make_shared<Node>("task_ros");
+
+    auto actor1_stand = std::make_shared<TaskBase>(TASK_STAND);
+    auto actor1_move = std::make_shared<TaskWithGoal>(TASK_MOVE_TO_GOAL);
+    TaskRequestRos actor1;
+    actor1.addTask(TASK_STAND, actor1_stand);
+    actor1.addTask(TASK_MOVE_TO_GOAL, actor1_move);
+    actor1.initialize(node, "bulk_validation1", "world");
+
+    auto actor2_stand = std::make_shared<TaskBase>(TASK_STAND);
+    TaskRequestRos actor2;
+    actor2.addTask(TASK_STAND, actor2_stand);
+    actor2.initialize(node, "bulk_validation2", "world");
+
+    std::vector<BulkTaskRequestRos::BulkTaskEntry> entries;
+    std::string error;
+
+    // empty goal
+    ASSERT_FALSE(BulkTaskRequestRos::requestTasks({}, entries, error));
+    ASSERT_FALSE(error.empty());
+
+    // unknown actor
+    ASSERT_FALSE(BulkTaskRequestRos::requestTasks(
+        {createTaskGoal("bulk_validation1", TASK_STAND), createTaskGoal("bulk_unknown", TASK_STAND)},
+        entries,
+        error
+    ));
+    ASSERT_FALSE(error.empty());
+    ASSERT_TRUE(entries.empty());
+
+    // actor listed twice
+    ASSERT_FALSE(BulkTaskRequestRos::requestTasks(
+        {createTaskGoal("bulk_validation1", TASK_STAND), createTaskGoal("bulk_validation1", TASK_MOVE_TO_GOAL)},
+        entries,
+        error
+    ));
+    ASSERT_FALSE(error.empty());
+    ASSERT_TRUE(entries.empty());
+
+    // task not defined for the actor
+    ASSERT_FALSE(BulkTaskRequestRos::requestTasks(
+        {createTaskGoal("bulk_validation1", TASK_STAND), createTaskGoal("bulk_validation2", TASK_MOVE_TO_GOAL)},
+        entries,
+        error
+    ));
+    ASSERT_FALSE(error.empty());
+    ASSERT_TRUE(entries.empty());
+
+    // none of the rejected goals requested anything
+    ASSERT_EQ(actor1_stand->getTaskFeedbackType(), TASK_FEEDBACK_UNDEFINED);
+    ASSERT_EQ(actor1_move->getTaskFeedbackType(), TASK_FEEDBACK_UNDEFINED);
+    ASSERT_EQ(actor2_stand->getTaskFeedbackType(), TASK_FEEDBACK_UNDEFINED);
+
+    // valid goal requests all tasks
+    ASSERT_TRUE(BulkTaskRequestRos::requestTasks(
+        {createTaskGoal("bulk_validation1", TASK_MOVE_TO_GOAL), createTaskGoal("bulk_validation2", TASK_STAND)},
+        entries,
+        error
+    ));
+    ASSERT_TRUE(error.empty());
+    ASSERT_EQ(entries.size(), 2);
+    ASSERT_EQ(entries.at(0).task_ptr, actor1_move);
+    ASSERT_EQ(entries.at(1).task_ptr, actor2_stand);
+    ASSERT_TRUE(actor1_move->isRequested());
+    ASSERT_TRUE(actor2_stand->isRequested());
+    ASSERT_EQ(actor1_stand->getTaskFeedbackType(), TASK_FEEDBACK_UNDEFINED);
+}
+
+/**
+ * @brief Once any task of the bulk request is rejected, tasks requested so far are withdrawn
+ * @details Requires running `roscore`
+ */
+TEST(HuberoTaskRequestRos, bulkRequestRollback) {
+    auto node = std::make_shared<Node>("task_ros");
+
+    auto actor1_stand = std::make_shared<TaskBase>(TASK_STAND);
+    TaskRequestRos actor1;
+    actor1.addTask(TASK_STAND, actor1_stand);
+    actor1.initialize(node, "bulk_rollback1", "world");
+
+    // the task does not expect the goal pose, so the request is rejected
+    auto actor2_move = std::make_shared<TaskBase>(TASK_MOVE_TO_GOAL);
+    TaskRequestRos actor2;
+    actor2.addTask(TASK_MOVE_TO_GOAL, actor2_move);
+    actor2.initialize(node, "bulk_rollback2", "world");
+
+    // the current goal of the same task is aborted before the new request
+    actor1_stand->request();
+    actor1_stand->activate();
+
+    std::vector<BulkTaskRequestRos::BulkTaskEntry> entries;
+    std::string error;
+    ASSERT_FALSE(BulkTaskRequestRos::requestTasks(
+        {createTaskGoal("bulk_rollback1", TASK_STAND), createTaskGoal("bulk_rollback2", TASK_MOVE_TO_GOAL)},
+        entries,
+        error
+    ));
+    ASSERT_FALSE(error.empty());
+    ASSERT_EQ(entries.size(), 2);
+    ASSERT_FALSE(actor1_stand->isRequested());
+    ASSERT_EQ(actor1_stand->getTaskFeedbackType(), TASK_FEEDBACK_ABORTED);
+    ASSERT_EQ(actor2_move->getTaskFeedbackType(), TASK_FEEDBACK_REJECTED);
+}
+
 int main(int argc, char** argv) {
 	testing::InitGoogleTest(&argc, argv);
 	return RUN_ALL_TESTS();
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <hubero_ros/utils/transform_batch.h>
+
+using namespace hubero;
+
+static geometry_msgs::TransformStamped createTransform(const std::string& child, double stamp) {
+	geometry_msgs::TransformStamped tf;
+	tf.header.stamp = ros::Time(stamp);
+	tf.header.frame_id = "world";
+	tf.child_frame_id = child;
+	return tf;
+}
+
+TEST(HuberoRosTransformBatch, singleMessagePerStep) {
+	std::vector<tf2_msgs::TFMessage> published;
+	TransformBatch batch([&published](const tf2_msgs::TFMessage& msg) { published.push_back(msg); });
+
+	// 3 actors within the first step
+	batch.add({createTransform("actor1/odom", 1.0), createTransform("actor1/base", 1.0)});
+	batch.add({createTransform("actor2/odom", 1.0), createTransform("actor2/base", 1.0)});
+	batch.add({createTransform("actor3/odom", 1.0), createTransform("actor3/base", 1.0)});
+	EXPECT_EQ(published.size(), 0);
+	EXPECT_EQ(batch.getSize(), 6);
+
+	// next step begins
+	batch.add({createTransform("actor1/odom", 1.1), createTransform("actor1/base", 1.1)});
+	ASSERT_EQ(published.size(), 1);
+	EXPECT_EQ(published.front().transforms.size(), 6);
+	EXPECT_EQ(batch.getSize(), 2);
+
+	// same stamp, but the frame is repeated - also a new step
+	batch.add({createTransform("actor2/odom", 1.1)});
+	batch.add({createTransform("actor1/odom", 1.1)});
+	ASSERT_EQ(published.size(), 2);
+	EXPECT_EQ(published.back().transforms.size(), 3);
+
+	batch.flush();
+	ASSERT_EQ(published.size(), 3);
+	EXPECT_EQ(published.back().transforms.size(), 1);
+	EXPECT_EQ(batch.getSize(), 0);
+
+	// nothing to publish
+	batch.flush();
+	EXPECT_EQ(published.size(), 3);
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
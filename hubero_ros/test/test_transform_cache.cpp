@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <hubero_ros/utils/transform_cache.h>
+
+using namespace hubero;
+
+static void expectPoseNear(const Pose3& actual, const Pose3& expected) {
+	EXPECT_NEAR(actual.Pos().X(), expected.Pos().X(), 1e-06);
+	EXPECT_NEAR(actual.Pos().Y(), expected.Pos().Y(), 1e-06);
+	EXPECT_NEAR(actual.Pos().Z(), expected.Pos().Z(), 1e-06);
+	EXPECT_NEAR(actual.Rot().Yaw(), expected.Rot().Yaw(), 1e-06);
+}
+
+TEST(HuberoRosTransformCache, staticChain) {
+	TransformCache cache;
+	Pose3 tf_world_map(1.0, 2.0, 0.0, 0.0, 0.0, IGN_PI_2);
+	Pose3 tf_map_odom(3.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+	// map expressed in world; odom expressed in map
+	cache.updateEdge("world", "map", tf_world_map, false);
+	cache.updateEdge("/map", "odom", tf_map_odom, true);
+
+	Pose3 transform;
+	ASSERT_TRUE(cache.find("odom", "world", transform));
+	// point in odom -> world
+	Pose3 pose_odom(1.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+	expectPoseNear(pose_odom + transform, pose_odom + tf_map_odom + tf_world_map);
+	EXPECT_EQ(cache.getCachedNum(), 1);
+
+	// opposite direction
+	ASSERT_TRUE(cache.find("world", "odom", transform));
+	expectPoseNear((pose_odom + tf_map_odom + tf_world_map) + transform, pose_odom);
+	EXPECT_EQ(cache.getCachedNum(), 2);
+
+	// identity and unknown frames
+	ASSERT_TRUE(cache.find("map", "map", transform));
+	expectPoseNear(transform, Pose3());
+	EXPECT_FALSE(cache.find("map", "unknown", transform));
+
+	// republishing the same value does not invalidate
+	cache.updateEdge("world", "map", tf_world_map, false);
+	EXPECT_EQ(cache.getCachedNum(), 3);
+}
+
+TEST(HuberoRosTransformCache, dynamicEdges) {
+	TransformCache cache;
+	cache.updateEdge("world", "map", Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0), false);
+	cache.updateEdge("map", "odom", Pose3(), false);
+	cache.updateEdge("odom", "base", Pose3(0.0, 0.0, 0.0, 0.0, 0.0, 0.0), false);
+
+	Pose3 transform;
+	ASSERT_TRUE(cache.find("base", "world", transform));
+	ASSERT_TRUE(cache.find("odom", "world", transform));
+
+	// actor moves - chains with 'base' are dropped and no longer resolvable, others are kept
+	cache.updateEdge("odom", "base", Pose3(0.5, 0.0, 0.0, 0.0, 0.0, 0.0), false);
+	EXPECT_EQ(cache.getCachedNum(), 1);
+	EXPECT_FALSE(cache.find("base", "world", transform));
+	ASSERT_TRUE(cache.find("odom", "world", transform));
+	expectPoseNear(transform, Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+
+	// further changes of the dynamic edge do not affect cached static chains
+	cache.updateEdge("odom", "base", Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0), false);
+	EXPECT_EQ(cache.getCachedNum(), 1);
+
+	// static edge updated
+	cache.updateEdge("world", "map", Pose3(2.0, 0.0, 0.0, 0.0, 0.0, 0.0), true);
+	EXPECT_EQ(cache.getCachedNum(), 0);
+	ASSERT_TRUE(cache.find("odom", "world", transform));
+	expectPoseNear(transform, Pose3(2.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+}
+
+TEST(HuberoRosTransformCache, invalidationScope) {
+	TransformCache cache;
+	cache.updateEdge("world", "map", Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0), true);
+	cache.updateEdge("map", "odom1", Pose3(), true);
+	cache.updateEdge("map", "odom2", Pose3(), true);
+
+	Pose3 transform;
+	ASSERT_TRUE(cache.find("odom1", "world", transform));
+	ASSERT_TRUE(cache.find("odom2", "world", transform));
+	ASSERT_TRUE(cache.find("odom1", "odom2", transform));
+	EXPECT_EQ(cache.getCachedNum(), 3);
+
+	// only chains through the changed edge are dropped
+	cache.updateEdge("map", "odom1", Pose3(0.0, 1.0, 0.0, 0.0, 0.0, 0.0), true);
+	EXPECT_EQ(cache.getCachedNum(), 1);
+	ASSERT_TRUE(cache.find("odom2", "world", transform));
+	expectPoseNear(transform, Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+	ASSERT_TRUE(cache.find("odom1", "odom2", transform));
+	expectPoseNear(transform, Pose3(0.0, 1.0, 0.0, 0.0, 0.0, 0.0));
+}
+
+TEST(HuberoRosTransformCache, stamps) {
+	TransformCache cache;
+	cache.updateEdge("world", "map", Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0), true, ros::Time(10.0));
+
+	Pose3 transform;
+	ASSERT_TRUE(cache.find("map", "world", transform));
+
+	// older transform does not overwrite the newer one
+	cache.updateEdge("world", "map", Pose3(2.0, 0.0, 0.0, 0.0, 0.0, 0.0), true, ros::Time(5.0));
+	EXPECT_EQ(cache.getCachedNum(), 1);
+	ASSERT_TRUE(cache.find("map", "world", transform));
+	expectPoseNear(transform, Pose3(1.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+
+	cache.updateEdge("world", "map", Pose3(3.0, 0.0, 0.0, 0.0, 0.0, 0.0), true, ros::Time(15.0));
+	EXPECT_EQ(cache.getCachedNum(), 0);
+	ASSERT_TRUE(cache.find("map", "world", transform));
+	expectPoseNear(transform, Pose3(3.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+}
+
+TEST(HuberoRosTransformCache, message) {
+	TransformCache cache;
+	tf2_msgs::TFMessage msg;
+	geometry_msgs::TransformStamped tf;
+	tf.header.frame_id = "world";
+	tf.child_frame_id = "map";
+	tf.transform.translation.x = 1.0;
+	tf.transform.rotation.w = 1.0;
+	msg.transforms.push_back(tf);
+	tf.header.frame_id = "map";
+	tf.child_frame_id = "odom";
+	tf.transform.translation.x = 2.0;
+	msg.transforms.push_back(tf);
+	cache.update(msg, true);
+
+	Pose3 transform;
+	ASSERT_TRUE(cache.find("odom", "world", transform));
+	expectPoseNear(transform, Pose3(3.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <hubero_ros/utils/triple_buffer.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace hubero;
+
+TEST(HuberoTripleBuffer, latestValue) {
+	TripleBuffer<int> buffer(7);
+	EXPECT_FALSE(buffer.isFresh());
+	EXPECT_EQ(buffer.read(), 7);
+
+	buffer.write(1);
+	EXPECT_TRUE(buffer.isFresh());
+	EXPECT_EQ(buffer.read(), 1);
+	EXPECT_FALSE(buffer.isFresh());
+	// value persists until the next write
+	EXPECT_EQ(buffer.read(), 1);
+
+	// intermediate values are skipped
+	buffer.write(2);
+	buffer.write(3);
+	buffer.write(4);
+	EXPECT_EQ(buffer.read(), 4);
+	EXPECT_EQ(buffer.read(), 4);
+}
+
+TEST(HuberoTripleBuffer, noTearing) {
+	// all elements of the consistent value are equal
+	typedef std::vector<int> Value;
+	const size_t VALUE_SIZE = 64;
+	const int WRITES = 20000;
+	TripleBuffer<Value> buffer(Value(VALUE_SIZE, 0));
+
+	std::atomic<bool> done(false);
+	auto producer = [&](int offset) {
+		for (int i = 1; i <= WRITES; i++) {
+			buffer.write(Value(VALUE_SIZE, 2 * i + offset));
+		}
+	};
+	std::thread producer_even(producer, 0);
+	std::thread producer_odd(producer, 1);
+	std::thread finisher([&]() {
+		producer_even.join();
+		producer_odd.join();
+		done = true;
+	});
+
+	size_t reads = 0;
+	while (!done) {
+		auto value = buffer.read();
+		ASSERT_EQ(value.size(), VALUE_SIZE);
+		for (size_t i = 1; i < VALUE_SIZE; i++) {
+			ASSERT_EQ(value[i], value[0]);
+		}
+		reads++;
+	}
+	finisher.join();
+	EXPECT_GT(reads, 0);
+	// finally, the value written last by one of the producers is observed
+	int last = buffer.read()[0];
+	EXPECT_TRUE(last == 2 * WRITES || last == 2 * WRITES + 1);
+}
+
+int main(int argc, char** argv) {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
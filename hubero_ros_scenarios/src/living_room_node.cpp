@@ -32,6 +32,14 @@ int main(int argc, char** argv) {
 	hubero::TaskRequestRosApi actor1("actor1");
 	hubero::TaskRequestRosApi actor2("actor2");
 
+	// all actors connect concurrently, wait for the slowest one
+	for (auto api: {&actor1, &actor2}) {
+		if (!api->waitForReady()) {
+			ROS_INFO("Node stopped!");
+			return (0);
+		}
+	}
+
 	// wait
 	ROS_INFO("TaskRequestRos APIs fired up, scenario execution will start in %lu seconds", launch_delay / 1000);
 	std::this_thread::sleep_for(std::chrono::milliseconds(launch_delay));
@@ -5,6 +5,7 @@
 #include <chrono>
 
 #include <hubero_common/defines.h>
+#include <hubero_ros/bulk_task_request_ros_api.h>
 #include <hubero_ros/task_request_ros_api.h>
 
 using namespace hubero;
@@ -17,6 +18,20 @@ void waitRefreshingRos() {
 	ros::spinOnce();
 }
 
+/// Waits until the task requested from @ref actor_name in the bulk request is no longer pending or active
+bool waitForTaskFinish(const hubero::BulkTaskRequestRosApi& tasks, const std::string& actor_name) {
+	while (
+		tasks.getTaskState(actor_name) == TASK_FEEDBACK_PENDING
+		|| tasks.getTaskState(actor_name) == TASK_FEEDBACK_ACTIVE
+	) {
+		if (!ros::ok()) {
+			return false;
+		}
+		waitRefreshingRos();
+	}
+	return true;
+}
+
 int main(int argc, char** argv) {
 	// node initialization
 	ros::init(argc, argv, "parking_scenario_node");
@@ -28,11 +43,15 @@ int main(int argc, char** argv) {
 		launch_delay = 1000 * std::stoi(argv[1]);
 	}
 
-	// create interfaces to request tasks from actors
-	hubero::TaskRequestRosApi actor1("actor1");
+	// create interfaces to request tasks from multiple actors at once and from a single actor
+	hubero::BulkTaskRequestRosApi tasks;
 	hubero::TaskRequestRosApi actor2("actor2");
-	hubero::TaskRequestRosApi actor3("actor3");
-	hubero::TaskRequestRosApi actor4("actor4");
+
+	// both connect concurrently
+	if (!tasks.waitForReady() || !actor2.waitForReady()) {
+		ROS_INFO("Node stopped!");
+		return (0);
+	}
 
 	// wait
 	ROS_INFO("TaskRequestRos APIs fired up, scenario execution will start in %lu seconds", launch_delay / 1000);
@@ -43,33 +62,20 @@ int main(int argc, char** argv) {
 	 * Actor2 goes to his friend, Actor1 goes to the dustbin */
 	ROS_INFO("[SCENARIO] Firing up the 1st stage!");
 
-	actor4.moveToGoal(Vector3(+0.5, +6.6, 0.0), IGN_PI, TF_FRAME_REF);
-	actor3.moveToGoal(Vector3(+0.3, +18.8, 0.0), IGN_PI, TF_FRAME_REF);
-	actor2.moveToGoal(Vector3(+7.0, +2.9, 0.0), 0.0, TF_FRAME_REF);
-	actor1.moveToGoal(Vector3(+1.2, -5.7, 0.0), IGN_PI, TF_FRAME_REF);
+	tasks.requestTasks({
+		BulkTaskRequestRosApi::createTaskGoal("actor4", TASK_MOVE_TO_GOAL, Vector3(+0.5, +6.6, 0.0), IGN_PI, TF_FRAME_REF),
+		BulkTaskRequestRosApi::createTaskGoal("actor3", TASK_MOVE_TO_GOAL, Vector3(+0.3, +18.8, 0.0), IGN_PI, TF_FRAME_REF),
+		BulkTaskRequestRosApi::createTaskGoal("actor2", TASK_MOVE_TO_GOAL, Vector3(+7.0, +2.9, 0.0), 0.0, TF_FRAME_REF),
+		BulkTaskRequestRosApi::createTaskGoal("actor1", TASK_MOVE_TO_GOAL, Vector3(+1.2, -5.7, 0.0), IGN_PI, TF_FRAME_REF)
+	});
 
 	ROS_INFO("[SCENARIO] 1st stage completed!");
 
 	// =================== 2nd stage ========================================
-	// we will be waiting for actor2's task finish, so we must also know if the task request was processed
-	if (actor2.getMoveToGoalState() != TASK_FEEDBACK_ACTIVE) {
-		while (actor2.getMoveToGoalState() != TASK_FEEDBACK_ACTIVE) {
-			if (!ros::ok()) {
-				ROS_INFO("Node stopped!");
-				return (0);
-			}
-			ROS_INFO("Waiting for Actor2 task to become active. Current state %d...", actor2.getMoveToGoalState());
-			waitRefreshingRos();
-		}
-	}
-
-	ROS_INFO("Task of Actor2 is active! Waiting until he finishes 'moveToGoal'");
-	while (actor2.getMoveToGoalState() == TASK_FEEDBACK_ACTIVE) {
-		if (!ros::ok()) {
-			ROS_INFO("Node stopped!");
-			return (0);
-		}
-		waitRefreshingRos();
+	ROS_INFO("Waiting until Actor2 finishes 'moveToGoal'");
+	if (!waitForTaskFinish(tasks, "actor2")) {
+		ROS_INFO("Node stopped!");
+		return (0);
 	}
 
 	ROS_INFO("[SCENARIO] Firing up the 2nd stage!");
@@ -88,25 +94,14 @@ int main(int argc, char** argv) {
 
 	// =================== 3rd stage ========================================
 
-	// actor1 will surely go for a longer time than actor2
-	if (actor1.getMoveToGoalState() != TASK_FEEDBACK_ACTIVE) {
-		while (actor1.getMoveToGoalState() != TASK_FEEDBACK_ACTIVE) {
-			if (!ros::ok()) {
-				ROS_INFO("Node stopped!");
-				return (0);
-			}
-			ROS_INFO("Waiting for Actor1 task to become active. Current state %d...", actor2.getMoveToGoalState());
-			waitRefreshingRos();
-		}
-	}
-
-	ROS_INFO("Task of Actor1 is active! Waiting until he finishes 'moveToGoal'");
-	while (actor1.getMoveToGoalState() == TASK_FEEDBACK_ACTIVE) {
-		if ( !ros::ok() ) {
+	// the next request would abort tasks of the 1st stage, so all of them must finish first
+	ROS_INFO("Waiting until Actor1, Actor3 and Actor4 reach their goals");
+	while (!tasks.waitForTasks(0.1)) {
+		if (!ros::ok()) {
 			ROS_INFO("Node stopped!");
 			return (0);
 		}
-		waitRefreshingRos();
+		ros::spinOnce();
 	}
 	ROS_INFO("Actor1 threw the rubbish away to the dumpster!");
 
@@ -114,36 +109,20 @@ int main(int argc, char** argv) {
 
 	/* Actor1 and Actor2 go to their cars */
 	ROS_INFO("Actor1 and Actor2 start moving towards their cars!");
-	actor2.moveToGoal(Vector3(-3.5, +10.5, 0.0), IGN_PI, TF_FRAME_REF);
-	actor1.moveToGoal(Vector3(-0.5, +14.8, 0.0), IGN_PI, TF_FRAME_REF);
-
-	// wait until request processed
-	if (actor1.getMoveToGoalState() != TASK_FEEDBACK_ACTIVE	|| actor2.getMoveToGoalState() != TASK_FEEDBACK_ACTIVE) {
-		while (actor1.getMoveToGoalState() != TASK_FEEDBACK_ACTIVE || actor2.getMoveToGoalState() != TASK_FEEDBACK_ACTIVE) {
-			if (!ros::ok()) {
-				ROS_INFO("Node stopped!");
-				return (0);
-			}
-			ROS_INFO(
-				"Waiting for Actor1 or Actor2 task to become active. Current state: A1 %d, A2 %d...",
-				actor1.getMoveToGoalState(),
-				actor2.getMoveToGoalState()
-			);
-			waitRefreshingRos();
-		}
-	}
+	tasks.requestTasks({
+		BulkTaskRequestRosApi::createTaskGoal("actor2", TASK_MOVE_TO_GOAL, Vector3(-3.5, +10.5, 0.0), IGN_PI, TF_FRAME_REF),
+		BulkTaskRequestRosApi::createTaskGoal("actor1", TASK_MOVE_TO_GOAL, Vector3(-0.5, +14.8, 0.0), IGN_PI, TF_FRAME_REF)
+	});
 
 	ROS_INFO("Actor1 and Actor2 are moving towards cars! Waiting until they reach their goal");
-	while (
-		actor1.getMoveToGoalState() == TASK_FEEDBACK_ACTIVE
-		|| actor2.getMoveToGoalState() == TASK_FEEDBACK_ACTIVE
-	) {
+	while (!tasks.waitForTasks(0.1)) {
 		if ( !ros::ok() ) {
 			ROS_INFO("Node stopped!");
 			return (0);
 		}
-		waitRefreshingRos();
+		ros::spinOnce();
 	}
+	ROS_INFO("Request finished with state: %s", tasks.getTasksStateDescription().c_str());
 
 	ROS_INFO("[SCENARIO] 3rd stage completed!");
 